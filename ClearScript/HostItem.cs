@@ -143,6 +143,24 @@ namespace Microsoft.ClearScript
             }
         }
 
+        public bool HasSharedMemberData
+        {
+            get { return targetMemberData is SharedHostObjectMemberData; }
+        }
+
+        public string[] GetAllMemberNames()
+        {
+            return HostInvoke(() =>
+            {
+                bool updated;
+                UpdateFieldNames(out updated);
+                UpdateMethodNames(out updated);
+                UpdatePropertyNames(out updated);
+
+                return AllFieldNames.Concat(AllMethodNames).Concat(AllPropertyNames).ToArray();
+            });
+        }
+
         public object InvokeMember(string name, BindingFlags invokeFlags, object[] args, object[] bindArgs, CultureInfo culture, bool bypassTunneling)
         {
             bool isCacheable;
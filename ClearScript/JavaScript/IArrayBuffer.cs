@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT license.
 
+using System;
+
 namespace Microsoft.ClearScript.JavaScript
 {
     /// <summary>
@@ -39,5 +41,22 @@ namespace Microsoft.ClearScript.JavaScript
         /// <param name="offset">The offset within the <c>ArrayBuffer</c> at which to store the first copied byte.</param>
         /// <returns>The number of bytes copied.</returns>
         ulong WriteBytes(byte[] source, ulong sourceIndex, ulong count, ulong offset);
+
+        /// <summary>
+        /// Invokes a delegate that accesses the <c>ArrayBuffer</c>'s contents in place.
+        /// </summary>
+        /// <param name="action">The delegate to invoke.</param>
+        /// <remarks>
+        /// <para>
+        /// The argument passed to <paramref name="action"/> is a pointer to the first byte of the
+        /// <c>ArrayBuffer</c>'s contents. It is valid only for the duration of the call, during which the script engine
+        /// is locked. No copying takes place.
+        /// </para>
+        /// <para>
+        /// If the <c>ArrayBuffer</c> is a <c>SharedArrayBuffer</c>, the pointer refers to memory that script code in
+        /// other runtimes may read and write concurrently; locking the script engine does not prevent that.
+        /// </para>
+        /// </remarks>
+        void InvokeWithDirectAccess(Action<IntPtr> action);
     }
 }
@@ -1350,7 +1350,7 @@ namespace Microsoft.ClearScript
 
         #region script-side invocation
 
-        internal ScriptFrame CurrentScriptFrame { get; private set; }
+        internal ScriptFrame CurrentScriptFrame { get; set; }
 
         internal IDisposable CreateEngineScope()
         {
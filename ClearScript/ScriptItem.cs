@@ -334,6 +334,32 @@ namespace Microsoft.ClearScript
 
         #endregion
 
+        #region ScriptObject overrides
+
+        public override object[] GetProperties(params string[] names)
+        {
+            MiscHelpers.VerifyNonNullArgument(names, "names");
+            return names.Select(name => GetProperty(name, ArrayHelpers.GetEmptyArray<object>())).ToArray();
+        }
+
+        public override void SetProperties(string[] names, object[] values)
+        {
+            MiscHelpers.VerifyNonNullArgument(names, "names");
+            MiscHelpers.VerifyNonNullArgument(values, "values");
+
+            if (names.Length != values.Length)
+            {
+                throw new ArgumentException("The name and value arrays must have the same length", "values");
+            }
+
+            for (var index = 0; index < names.Length; index++)
+            {
+                SetProperty(names[index], new[] { values[index] });
+            }
+        }
+
+        #endregion
+
         #region IDynamic implementation
 
         public object GetProperty(string name, object[] args, out bool isCacheable)
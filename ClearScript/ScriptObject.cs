@@ -21,5 +21,28 @@ namespace Microsoft.ClearScript
         /// Gets the script engine that owns the object.
         /// </summary>
         public abstract ScriptEngine Engine { get; }
+
+        /// <summary>
+        /// Gets the values of the specified properties of the script object.
+        /// </summary>
+        /// <param name="names">The names of the properties to get.</param>
+        /// <returns>An array containing the property values, in the order of <paramref name="names"/>.</returns>
+        /// <remarks>
+        /// Missing properties produce <see cref="Undefined.Value"/>. Some script engines, such as
+        /// <see cref="V8.V8ScriptEngine"/>, read all the properties in a single operation, which is
+        /// considerably faster than reading them one at a time.
+        /// </remarks>
+        public abstract object[] GetProperties(params string[] names);
+
+        /// <summary>
+        /// Sets the values of the specified properties of the script object.
+        /// </summary>
+        /// <param name="names">The names of the properties to set.</param>
+        /// <param name="values">The values to assign, in the order of <paramref name="names"/>.</param>
+        /// <remarks>
+        /// Some script engines, such as <see cref="V8.V8ScriptEngine"/>, set all the properties in
+        /// a single operation, which is considerably faster than setting them one at a time.
+        /// </remarks>
+        public abstract void SetProperties(string[] names, object[] values);
     }
 }
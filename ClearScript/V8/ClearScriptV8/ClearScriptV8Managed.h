@@ -11,16 +11,21 @@
 #include "WeakRef.h"
 #include "V8ObjectHolder.h"
 #include "V8ScriptHolder.h"
+#include "V8ScriptCompilation.h"
 #include "HostObjectHolder.h"
 #include "V8Value.h"
 #include "HostException.h"
 #include "V8Exception.h"
 #include "V8IsolateConstraints.h"
 #include "V8IsolateHeapInfo.h"
+#include "V8IsolateCodeCacheInfo.h"
 #include "V8DocumentInfo.h"
 #include "V8CacheType.h"
+#include "V8SnapshotBlob.h"
 #include "V8Isolate.h"
 #include "V8Context.h"
+#include "V8IsolateGroup.h"
+#include "V8SharedScriptCache.h"
 #include "HostObjectHolderImpl.h"
 #include "V8ObjectHelpers.h"
 #include "HostObjectHelpers.h"
@@ -28,6 +33,9 @@
 #include "V8ContextProxyImpl.h"
 #include "V8ObjectImpl.h"
 #include "V8ScriptImpl.h"
+#include "V8SnapshotProxyImpl.h"
+#include "V8IsolateGroupProxyImpl.h"
+#include "V8SharedScriptCacheProxyImpl.h"
 #include "V8DebugListenerImpl.h"
 #include "NativeCallbackImpl.h"
 #include "V8TestProxyImpl.h"
@@ -13,23 +13,36 @@
 #include "WeakRef.h"
 #include "V8ObjectHolder.h"
 #include "V8ScriptHolder.h"
+#include "V8ScriptCompilation.h"
 #include "HostObjectHolder.h"
 #include "V8Value.h"
 #include "HostException.h"
 #include "V8Exception.h"
 #include "V8IsolateConstraints.h"
 #include "V8IsolateHeapInfo.h"
+#include "V8IsolateCodeCacheInfo.h"
 #include "V8DocumentInfo.h"
 #include "V8CacheType.h"
+#include "V8SnapshotBlob.h"
 #include "V8Isolate.h"
 #include "V8Context.h"
+#include "V8IsolateGroup.h"
+#include "V8SharedScriptCache.h"
 #include "HostObjectHolderImpl.h"
 #include "V8ObjectHelpers.h"
 #include "HostObjectHelpers.h"
-#include "Timer.h"
+#include "V8WorkerPool.h"
+#include "V8TimerWheel.h"
+#include "V8CallWithLockQueue.h"
+#include "V8CodeCacheStore.h"
+#include "V8ArrayBufferAllocator.h"
+#include "V8SharedArrayBufferStore.h"
+#include "V8SharedScriptCacheImpl.h"
 #include "V8IsolateImpl.h"
 #include "V8ContextImpl.h"
+#include "V8IsolateGroupImpl.h"
 #include "V8WeakContextBinding.h"
 #include "V8ObjectHolderImpl.h"
 #include "V8ScriptHolderImpl.h"
+#include "V8ScriptCompilationImpl.h"
 #include "HighResolutionClock.h"
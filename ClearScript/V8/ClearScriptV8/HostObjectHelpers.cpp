@@ -238,6 +238,20 @@ HostObjectHelpers::V8Invocability HostObjectHelpers::GetInvocability(void* pvObj
 
 //-----------------------------------------------------------------------------
 
+void* HostObjectHelpers::GetTemplateKey(void* pvObject)
+{
+    try
+    {
+        return V8ProxyHelpers::GetHostObjectTemplateKey(pvObject).ToPointer();
+    }
+    catch (Exception^ gcException)
+    {
+        ThrowHostException(pvObject, gcException);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 V8Value HostObjectHelpers::GetEnumerator(void* pvObject)
 {
     try
@@ -364,6 +378,20 @@ void HostObjectHelpers::DestroyNativeCallbackTimer(void* pvTimer)
 
 //-----------------------------------------------------------------------------
 
+void* HostObjectHelpers::SuspendScriptInvocations()
+{
+    return V8ProxyHelpers::SuspendScriptInvocations();
+}
+
+//-----------------------------------------------------------------------------
+
+void HostObjectHelpers::ResumeScriptInvocations(void* pvState)
+{
+    V8ProxyHelpers::ResumeScriptInvocations(pvState);
+}
+
+//-----------------------------------------------------------------------------
+
 bool HostObjectHelpers::TryParseInt32(const StdString& text, int& result)
 {
     return Int32::TryParse(text.ToManagedString(), NumberStyles::Integer, CultureInfo::InvariantCulture, result);
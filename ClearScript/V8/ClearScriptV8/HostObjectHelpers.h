@@ -32,6 +32,7 @@ public:
 
     enum class V8Invocability { None, Delegate, Other };
     static V8Invocability GetInvocability(void* pvObject);
+    static void* GetTemplateKey(void* pvObject);
 
     static V8Value GetEnumerator(void* pvObject);
     static bool AdvanceEnumerator(void* pvEnumerator, V8Value& value);
@@ -54,5 +55,8 @@ public:
     static bool ChangeNativeCallbackTimer(void* pvTimer, int dueTime, int period);
     static void DestroyNativeCallbackTimer(void* pvTimer);
 
+    static void* SuspendScriptInvocations();
+    static void ResumeScriptInvocations(void* pvState);
+
     static bool TryParseInt32(const StdString& text, int& result);
 };
@@ -14,6 +14,7 @@
 //-----------------------------------------------------------------------------
 
 #include <msclr\all.h>
+#include <vcclr.h>
 
 //-----------------------------------------------------------------------------
 // assembly references
@@ -29,6 +30,7 @@ using namespace System;
 using namespace System::Globalization;
 using namespace System::Runtime::InteropServices;
 using namespace System::Threading;
+using namespace System::Threading::Tasks;
 using namespace Microsoft::ClearScript;
 using namespace Microsoft::ClearScript::JavaScript;
 using namespace Microsoft::ClearScript::Util;
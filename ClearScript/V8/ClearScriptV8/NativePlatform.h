@@ -15,5 +15,10 @@
 
 #include <atomic>
 #include <chrono>
+#include <cmath>
 #include <condition_variable>
+#include <deque>
+#include <list>
+#include <map>
 #include <mutex>
+#include <thread>
@@ -3,10 +3,143 @@
 
 #include "ClearScriptV8Native.h"
 
+//-----------------------------------------------------------------------------
+// ExternalOneByteString
+//-----------------------------------------------------------------------------
+
+class ExternalOneByteString: public v8::String::ExternalOneByteStringResource
+{
+    PROHIBIT_COPY(ExternalOneByteString)
+
+public:
+
+    ExternalOneByteString(const wchar_t* pValue, size_t length):
+        m_Value(length, '\0')
+    {
+        for (size_t index = 0; index < length; index++)
+        {
+            m_Value[index] = static_cast<char>(pValue[index]);
+        }
+    }
+
+    virtual const char* data() const override
+    {
+        return m_Value.data();
+    }
+
+    virtual size_t length() const override
+    {
+        return m_Value.length();
+    }
+
+private:
+
+    std::string m_Value;
+};
+
+//-----------------------------------------------------------------------------
+// ExternalTwoByteString
+//-----------------------------------------------------------------------------
+
+class ExternalTwoByteString: public v8::String::ExternalStringResource
+{
+    PROHIBIT_COPY(ExternalTwoByteString)
+
+public:
+
+    ExternalTwoByteString(const wchar_t* pValue, size_t length):
+        m_Value(pValue, length)
+    {
+    }
+
+    virtual const uint16_t* data() const override
+    {
+        return reinterpret_cast<const uint16_t*>(m_Value.data());
+    }
+
+    virtual size_t length() const override
+    {
+        return m_Value.length();
+    }
+
+private:
+
+    std::wstring m_Value;
+};
+
+//-----------------------------------------------------------------------------
+// local helper functions
+//-----------------------------------------------------------------------------
+
+// Strings at least this long are handed to V8 as external strings. Their contents live outside
+// the V8 heap, so they neither count against heap limits nor get copied by the garbage collector.
+
+static const int s_MinExternalStringLength = 16 * 1024;
+
+//-----------------------------------------------------------------------------
+
+static bool IsOneByte(const wchar_t* pValue, size_t length)
+{
+    for (size_t index = 0; index < length; index++)
+    {
+        if (pValue[index] > 0xFF)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // StdString implementation
 //-----------------------------------------------------------------------------
 
+v8::MaybeLocal<v8::String> StdString::ToV8String(v8::Isolate* pIsolate, const wchar_t* pValue, int length)
+{
+    if (length >= s_MinExternalStringLength)
+    {
+        // Latin-1 content is narrowed to half its size; V8 disposes the resource when the
+        // string is collected
+
+        if (IsOneByte(pValue, length))
+        {
+            return v8::String::NewExternalOneByte(pIsolate, new ExternalOneByteString(pValue, length));
+        }
+
+        return v8::String::NewExternalTwoByte(pIsolate, new ExternalTwoByteString(pValue, length));
+    }
+
+    // V8 stores Latin-1 content in one-byte form regardless of the source encoding
+    return v8::String::NewFromTwoByte(pIsolate, reinterpret_cast<const uint16_t*>(pValue), v8::NewStringType::kNormal, length);
+}
+
+//-----------------------------------------------------------------------------
+
+std::wstring StdString::GetValue(v8::Isolate* pIsolate, v8::Local<v8::Value> hValue)
+{
+    if (!hValue.IsEmpty() && hValue->IsString())
+    {
+        // write string content directly into the result, bypassing v8::String::Value
+        auto hString = hValue.As<v8::String>();
+
+        auto length = hString->Length();
+        if (length < 1)
+        {
+            return std::wstring();
+        }
+
+        std::wstring value(length, L'\0');
+        hString->Write(pIsolate, reinterpret_cast<uint16_t*>(&value[0]), 0, length, v8::String::NO_NULL_TERMINATION);
+        return value;
+    }
+
+    v8::String::Value value(pIsolate, hValue);
+    return std::wstring(EnsureNonNull(*value), value.length());
+}
+
+//-----------------------------------------------------------------------------
+
 std::wstring StdString::GetValue(const v8_inspector::StringView& stringView)
 {
     auto length = stringView.length();
@@ -222,9 +222,11 @@ public:
 
     v8::MaybeLocal<v8::String> ToV8String(v8::Isolate* pIsolate) const
     {
-        return v8::String::NewFromTwoByte(pIsolate, reinterpret_cast<const uint16_t*>(ToCString()), v8::NewStringType::kNormal, GetLength());
+        return ToV8String(pIsolate, ToCString(), GetLength());
     }
 
+    static v8::MaybeLocal<v8::String> ToV8String(v8::Isolate* pIsolate, const wchar_t* pValue, int length);
+
     v8_inspector::StringView GetStringView(size_t index = 0, size_t length = SIZE_MAX) const
     {
         auto valueLength = m_Value.length();
@@ -235,12 +237,7 @@ public:
 
 private:
 
-    static std::wstring GetValue(v8::Isolate* pIsolate, v8::Local<v8::Value> hValue)
-    {
-        v8::String::Value value(pIsolate, hValue);
-        return std::wstring(EnsureNonNull(*value), value.length());
-    }
-
+    static std::wstring GetValue(v8::Isolate* pIsolate, v8::Local<v8::Value> hValue);
     static std::wstring GetValue(const v8_inspector::StringView& stringView);
 
 #endif // !_M_CEE
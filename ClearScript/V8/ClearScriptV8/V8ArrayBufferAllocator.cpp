@@ -0,0 +1,369 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Native.h"
+#include <windows.h>
+
+//-----------------------------------------------------------------------------
+// local helper types and functions
+//-----------------------------------------------------------------------------
+
+static const size_t s_MinClassSize = 16;
+static const size_t s_MaxClassSize = 64 * 1024;
+static const size_t s_SizeClassCount = 13;
+static const size_t s_MaxThreadCacheSizePerClass = 32 * 1024;
+static const size_t s_MinThreadCacheCapacity = 2;
+static const size_t s_MaxPoolSizePerClass = 1024 * 1024;
+
+static_assert((s_MinClassSize << (s_SizeClassCount - 1)) == s_MaxClassSize, "Inconsistent ArrayBuffer size classes");
+
+//-----------------------------------------------------------------------------
+
+static size_t GetSizeClass(size_t size)
+{
+    size_t sizeClass = 0;
+    for (auto classSize = s_MinClassSize; classSize < size; classSize <<= 1)
+    {
+        ++sizeClass;
+    }
+
+    return sizeClass;
+}
+
+//-----------------------------------------------------------------------------
+
+static size_t GetClassSize(size_t sizeClass)
+{
+    return s_MinClassSize << sizeClass;
+}
+
+//-----------------------------------------------------------------------------
+
+static size_t GetThreadCacheCapacity(size_t sizeClass)
+{
+    // thread caches are bounded in bytes so that large classes don't pin megabytes per thread
+    return (std::max)(s_MaxThreadCacheSizePerClass / GetClassSize(sizeClass), s_MinThreadCacheCapacity); // parenthesized to avoid the windows.h macro
+}
+
+//-----------------------------------------------------------------------------
+// V8ArrayBufferPool
+//
+// Blocks released by a thread go to its cache; when a cache list overflows, half of it moves to
+// the shared pool, which in turn returns blocks to the heap beyond a per-class size limit. Trim
+// empties the shared pool and has each thread cache spill its blocks the next time it's used.
+//
+// The pool is never destroyed. Thread caches spill into it when their threads exit, which can
+// happen after static destruction during process shutdown.
+//-----------------------------------------------------------------------------
+
+class V8ArrayBufferPool
+{
+    PROHIBIT_COPY(V8ArrayBufferPool)
+
+public:
+
+    static V8ArrayBufferPool& GetInstance();
+
+    void* AllocateBlock(size_t sizeClass);
+    void FreeBlock(void* pvBlock, size_t sizeClass);
+    void Trim();
+
+private:
+
+    class ThreadCache
+    {
+        PROHIBIT_COPY(ThreadCache)
+
+    public:
+
+        explicit ThreadCache(V8ArrayBufferPool& pool);
+        ~ThreadCache();
+
+        std::vector<void*>& GetFreeList(size_t sizeClass);
+
+    private:
+
+        V8ArrayBufferPool& m_Pool;
+        std::uint64_t m_TrimCount;
+        std::vector<void*> m_FreeLists[s_SizeClassCount];
+    };
+
+    V8ArrayBufferPool():
+        m_TrimCount(0)
+    {
+    }
+
+    ThreadCache& GetThreadCache();
+
+    void Refill(std::vector<void*>& freeList, size_t sizeClass);
+    void Spill(std::vector<void*>& freeList, size_t sizeClass, size_t count);
+
+    SimpleMutex m_Mutex;
+    std::vector<void*> m_FreeLists[s_SizeClassCount];
+    std::atomic<std::uint64_t> m_TrimCount;
+};
+
+//-----------------------------------------------------------------------------
+
+V8ArrayBufferPool& V8ArrayBufferPool::GetInstance()
+{
+    static V8ArrayBufferPool* s_pInstance = new V8ArrayBufferPool;
+    return *s_pInstance;
+}
+
+//-----------------------------------------------------------------------------
+
+void* V8ArrayBufferPool::AllocateBlock(size_t sizeClass)
+{
+    auto& freeList = GetThreadCache().GetFreeList(sizeClass);
+    if (freeList.empty())
+    {
+        Refill(freeList, sizeClass);
+        if (freeList.empty())
+        {
+            return ::malloc(GetClassSize(sizeClass));
+        }
+    }
+
+    auto pvBlock = freeList.back();
+    freeList.pop_back();
+    return pvBlock;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ArrayBufferPool::FreeBlock(void* pvBlock, size_t sizeClass)
+{
+    auto& freeList = GetThreadCache().GetFreeList(sizeClass);
+    auto capacity = GetThreadCacheCapacity(sizeClass);
+    if (freeList.size() >= capacity)
+    {
+        Spill(freeList, sizeClass, capacity / 2);
+    }
+
+    freeList.push_back(pvBlock);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ArrayBufferPool::Trim()
+{
+    ++m_TrimCount;
+
+    BEGIN_MUTEX_SCOPE(m_Mutex)
+
+        for (auto& poolList : m_FreeLists)
+        {
+            for (auto pvBlock : poolList)
+            {
+                ::free(pvBlock);
+            }
+
+            std::vector<void*>().swap(poolList);
+        }
+
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+V8ArrayBufferPool::ThreadCache::ThreadCache(V8ArrayBufferPool& pool):
+    m_Pool(pool),
+    m_TrimCount(pool.m_TrimCount)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+V8ArrayBufferPool::ThreadCache::~ThreadCache()
+{
+    for (size_t sizeClass = 0; sizeClass < s_SizeClassCount; sizeClass++)
+    {
+        m_Pool.Spill(m_FreeLists[sizeClass], sizeClass, m_FreeLists[sizeClass].size());
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+std::vector<void*>& V8ArrayBufferPool::ThreadCache::GetFreeList(size_t sizeClass)
+{
+    // a trim since this cache was last used returns everything it holds to the heap
+    std::uint64_t trimCount = m_Pool.m_TrimCount;
+    if (trimCount != m_TrimCount)
+    {
+        m_TrimCount = trimCount;
+        for (auto& freeList : m_FreeLists)
+        {
+            for (auto pvBlock : freeList)
+            {
+                ::free(pvBlock);
+            }
+
+            std::vector<void*>().swap(freeList);
+        }
+    }
+
+    return m_FreeLists[sizeClass];
+}
+
+//-----------------------------------------------------------------------------
+
+V8ArrayBufferPool::ThreadCache& V8ArrayBufferPool::GetThreadCache()
+{
+    thread_local ThreadCache t_ThreadCache(*this);
+    return t_ThreadCache;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ArrayBufferPool::Refill(std::vector<void*>& freeList, size_t sizeClass)
+{
+    BEGIN_MUTEX_SCOPE(m_Mutex)
+
+        auto& poolList = m_FreeLists[sizeClass];
+        auto count = (std::min)(poolList.size(), GetThreadCacheCapacity(sizeClass) / 2); // parenthesized to avoid the windows.h macro
+        freeList.insert(freeList.end(), poolList.end() - count, poolList.end());
+        poolList.resize(poolList.size() - count);
+
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ArrayBufferPool::Spill(std::vector<void*>& freeList, size_t sizeClass, size_t count)
+{
+    auto maxPoolCount = s_MaxPoolSizePerClass / GetClassSize(sizeClass);
+
+    BEGIN_MUTEX_SCOPE(m_Mutex)
+
+        auto& poolList = m_FreeLists[sizeClass];
+        while ((count > 0) && !freeList.empty())
+        {
+            if (poolList.size() < maxPoolCount)
+            {
+                poolList.push_back(freeList.back());
+            }
+            else
+            {
+                ::free(freeList.back());
+            }
+
+            freeList.pop_back();
+            --count;
+        }
+
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+// V8ArrayBufferAllocator implementation
+//-----------------------------------------------------------------------------
+
+V8ArrayBufferAllocator::V8ArrayBufferAllocator():
+    m_Size(0),
+    m_PeakSize(0),
+    m_Count(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void* V8ArrayBufferAllocator::Allocate(size_t size)
+{
+    if (size > s_MaxClassSize)
+    {
+        // fresh pages from the operating system are already zeroed
+        return AllocateUninitialized(size);
+    }
+
+    auto pvData = AllocateUninitialized(size);
+    if (pvData != nullptr)
+    {
+        // pooled blocks are zeroed only up to the requested size
+        memset(pvData, 0, size);
+    }
+
+    return pvData;
+}
+
+//-----------------------------------------------------------------------------
+
+void* V8ArrayBufferAllocator::AllocateUninitialized(size_t size)
+{
+    void* pvData;
+    if (size > s_MaxClassSize)
+    {
+        pvData = ::VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    }
+    else
+    {
+        pvData = V8ArrayBufferPool::GetInstance().AllocateBlock(GetSizeClass(size));
+    }
+
+    if (pvData != nullptr)
+    {
+        OnAllocated(size);
+    }
+
+    return pvData;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ArrayBufferAllocator::Free(void* pvData, size_t size)
+{
+    if (pvData == nullptr)
+    {
+        return;
+    }
+
+    FreeUntracked(pvData, size);
+    Untrack(size);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ArrayBufferAllocator::Untrack(size_t size)
+{
+    m_Size -= size;
+    --m_Count;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ArrayBufferAllocator::FreeUntracked(void* pvData, size_t size)
+{
+    if (pvData == nullptr)
+    {
+        return;
+    }
+
+    if (size > s_MaxClassSize)
+    {
+        ::VirtualFree(pvData, 0, MEM_RELEASE);
+    }
+    else
+    {
+        V8ArrayBufferPool::GetInstance().FreeBlock(pvData, GetSizeClass(size));
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ArrayBufferAllocator::Trim()
+{
+    V8ArrayBufferPool::GetInstance().Trim();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ArrayBufferAllocator::OnAllocated(size_t size)
+{
+    auto newSize = m_Size += size;
+    ++m_Count;
+
+    auto peakSize = m_PeakSize.load();
+    while ((newSize > peakSize) && !m_PeakSize.compare_exchange_weak(peakSize, newSize))
+    {
+    }
+}
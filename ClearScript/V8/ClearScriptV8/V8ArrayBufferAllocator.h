@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8ArrayBufferAllocator
+//
+// Each isolate has its own allocator so that its ArrayBuffer memory usage can be tracked. The
+// memory itself comes from a process-wide pool. Small buffers use power-of-two size classes with
+// per-thread caches. Large buffers use fresh pages from the operating system, which are already
+// zeroed.
+//-----------------------------------------------------------------------------
+
+class V8ArrayBufferAllocator: public v8::ArrayBuffer::Allocator
+{
+    PROHIBIT_COPY(V8ArrayBufferAllocator)
+
+public:
+
+    V8ArrayBufferAllocator();
+
+    virtual void* Allocate(size_t size) override;
+    virtual void* AllocateUninitialized(size_t size) override;
+    virtual void Free(void* pvData, size_t size) override;
+
+    size_t GetSize() const { return m_Size; }
+    size_t GetPeakSize() const { return m_PeakSize; }
+    size_t GetCount() const { return m_Count; }
+
+    // Externalized memory is no longer charged to the isolate; it's released by its new owner.
+    void Untrack(size_t size);
+    static void FreeUntracked(void* pvData, size_t size);
+
+    // Releases pooled blocks to the heap after a low-memory notification.
+    static void Trim();
+
+private:
+
+    void OnAllocated(size_t size);
+
+    std::atomic<size_t> m_Size;
+    std::atomic<size_t> m_PeakSize;
+    std::atomic<size_t> m_Count;
+};
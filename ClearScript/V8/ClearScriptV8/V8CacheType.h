@@ -11,5 +11,6 @@ enum class V8CacheType
 {
     None,
     Parser,
-    Code
+    Code,
+    EagerCode
 };
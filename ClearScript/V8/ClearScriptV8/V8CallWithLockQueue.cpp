@@ -0,0 +1,167 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Native.h"
+
+//-----------------------------------------------------------------------------
+// local helper functions
+//-----------------------------------------------------------------------------
+
+// IMPORTANT: must be a power of two
+static const size_t s_RingCapacity = 256;
+static const size_t s_RingMask = s_RingCapacity - 1;
+
+//-----------------------------------------------------------------------------
+// V8CallWithLockQueue implementation
+//-----------------------------------------------------------------------------
+
+V8CallWithLockQueue::V8CallWithLockQueue():
+    m_spCells(new Cell[s_RingCapacity]),
+    m_EnqueuePosition(0),
+    m_DequeuePosition(0),
+    m_OverflowCount(0)
+{
+    for (size_t index = 0; index < s_RingCapacity; index++)
+    {
+        m_spCells[index].Sequence.store(index, std::memory_order_relaxed);
+    }
+
+    for (auto& count : m_LatencyHistogram)
+    {
+        count.store(0, std::memory_order_relaxed);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8CallWithLockQueue::Enqueue(Callback&& callback)
+{
+    auto enqueueTime = Clock::now();
+
+    // Once the ring overflows, producers use the overflow queue until the consumer drains it.
+    // This keeps callbacks in approximate FIFO order under sustained load.
+
+    if ((m_OverflowCount.load(std::memory_order_acquire) == 0) && TryEnqueue(callback, enqueueTime))
+    {
+        return;
+    }
+
+    BEGIN_MUTEX_SCOPE(m_OverflowMutex)
+        m_OverflowQueue.push(OverflowEntry { std::move(callback), enqueueTime });
+        m_OverflowCount.fetch_add(1, std::memory_order_release);
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8CallWithLockQueue::TryDequeue(Callback& callback)
+{
+    auto& cell = m_spCells[m_DequeuePosition & s_RingMask];
+    if (cell.Sequence.load(std::memory_order_acquire) == (m_DequeuePosition + 1))
+    {
+        callback = std::move(cell.Func);
+        RecordLatency(cell.EnqueueTime);
+
+        // release the cell to producers one lap ahead
+        cell.Sequence.store(m_DequeuePosition + s_RingCapacity, std::memory_order_release);
+        ++m_DequeuePosition;
+        return true;
+    }
+
+    if (m_OverflowCount.load(std::memory_order_acquire) > 0)
+    {
+        BEGIN_MUTEX_SCOPE(m_OverflowMutex)
+
+            if (!m_OverflowQueue.empty())
+            {
+                auto& entry = m_OverflowQueue.front();
+                callback = std::move(entry.Func);
+                RecordLatency(entry.EnqueueTime);
+
+                m_OverflowQueue.pop();
+                m_OverflowCount.fetch_sub(1, std::memory_order_release);
+                return true;
+            }
+
+        END_MUTEX_SCOPE
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8CallWithLockQueue::IsEmpty() const
+{
+    auto& cell = m_spCells[m_DequeuePosition & s_RingMask];
+    return (cell.Sequence.load(std::memory_order_acquire) != (m_DequeuePosition + 1)) && (m_OverflowCount.load(std::memory_order_acquire) == 0);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8CallWithLockQueue::GetLatencyHistogram(std::vector<std::uint64_t>& histogram) const
+{
+    histogram.resize(LatencyBucketCount);
+    for (size_t index = 0; index < LatencyBucketCount; index++)
+    {
+        histogram[index] = m_LatencyHistogram[index].load(std::memory_order_relaxed);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+V8CallWithLockQueue::~V8CallWithLockQueue()
+{
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8CallWithLockQueue::TryEnqueue(Callback& callback, Clock::time_point enqueueTime)
+{
+    auto position = m_EnqueuePosition.load(std::memory_order_relaxed);
+    while (true)
+    {
+        auto& cell = m_spCells[position & s_RingMask];
+        auto sequence = cell.Sequence.load(std::memory_order_acquire);
+        auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+        if (difference == 0)
+        {
+            // the cell is free; claim it
+            if (m_EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                cell.Func = std::move(callback);
+                cell.EnqueueTime = enqueueTime;
+                cell.Sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            // the ring is full
+            return false;
+        }
+        else
+        {
+            // another producer claimed the cell; retry
+            position = m_EnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8CallWithLockQueue::RecordLatency(Clock::time_point enqueueTime)
+{
+    auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - enqueueTime).count();
+
+    size_t bucket = 0;
+    while ((microseconds > 0) && (bucket < (LatencyBucketCount - 1)))
+    {
+        microseconds >>= 1;
+        bucket++;
+    }
+
+    // only the consumer updates the histogram; atomicity serves concurrent readers
+    m_LatencyHistogram[bucket].store(m_LatencyHistogram[bucket].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
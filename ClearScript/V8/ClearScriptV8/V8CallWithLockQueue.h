@@ -0,0 +1,209 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+class V8IsolateImpl;
+
+//-----------------------------------------------------------------------------
+// V8CallWithLockQueue
+//
+// A multi-producer, single-consumer queue of callbacks awaiting the isolate lock. Producers
+// enqueue into a bounded ring without locking; if the ring is full, they fall back to a
+// mutex-protected overflow queue. The consumer must hold the isolate lock.
+//-----------------------------------------------------------------------------
+
+class V8CallWithLockQueue
+{
+    PROHIBIT_COPY(V8CallWithLockQueue)
+
+public:
+
+    //-------------------------------------------------------------------------
+    // Callback - a move-only callable that stores small functors inline
+    //-------------------------------------------------------------------------
+
+    class Callback
+    {
+        PROHIBIT_COPY(Callback)
+
+    public:
+
+        Callback():
+            m_pInvoke(nullptr),
+            m_pManage(nullptr)
+        {
+        }
+
+        template <typename TFunc, typename = typename std::enable_if<!std::is_same<typename std::decay<TFunc>::type, Callback>::value>::type>
+        Callback(TFunc&& func):
+            m_pInvoke(nullptr),
+            m_pManage(nullptr)
+        {
+            Construct<typename std::decay<TFunc>::type>(std::forward<TFunc>(func), std::integral_constant<bool, IsInline<typename std::decay<TFunc>::type>()>());
+        }
+
+        Callback(Callback&& that):
+            m_pInvoke(nullptr),
+            m_pManage(nullptr)
+        {
+            MoveFrom(that);
+        }
+
+        Callback& operator=(Callback&& that)
+        {
+            if (this != &that)
+            {
+                Reset();
+                MoveFrom(that);
+            }
+
+            return *this;
+        }
+
+        explicit operator bool() const
+        {
+            return m_pInvoke != nullptr;
+        }
+
+        void operator()(V8IsolateImpl* pIsolateImpl)
+        {
+            m_pInvoke(&m_Storage, pIsolateImpl);
+        }
+
+        void Reset()
+        {
+            if (m_pManage != nullptr)
+            {
+                m_pManage(&m_Storage, nullptr);
+                m_pInvoke = nullptr;
+                m_pManage = nullptr;
+            }
+        }
+
+        ~Callback()
+        {
+            Reset();
+        }
+
+    private:
+
+        using Storage = std::aligned_storage<6 * sizeof(void*), alignof(void*)>::type;
+
+        // destroys the functor in pvStorage, moving it to pvTarget first if pvTarget is non-null
+        using ManageFunc = void (*)(void* pvStorage, void* pvTarget);
+        using InvokeFunc = void (*)(void* pvStorage, V8IsolateImpl* pIsolateImpl);
+
+        template <typename TFunc>
+        static constexpr bool IsInline()
+        {
+            return (sizeof(TFunc) <= sizeof(Storage)) && (alignof(TFunc) <= alignof(Storage)) && std::is_nothrow_move_constructible<TFunc>::value;
+        }
+
+        template <typename TFunc, typename TArg>
+        void Construct(TArg&& func, std::true_type /*isInline*/)
+        {
+            new (&m_Storage) TFunc(std::forward<TArg>(func));
+
+            m_pInvoke = [] (void* pvStorage, V8IsolateImpl* pIsolateImpl)
+            {
+                (*static_cast<TFunc*>(pvStorage))(pIsolateImpl);
+            };
+
+            m_pManage = [] (void* pvStorage, void* pvTarget)
+            {
+                auto pFunc = static_cast<TFunc*>(pvStorage);
+                if (pvTarget != nullptr)
+                {
+                    new (pvTarget) TFunc(std::move(*pFunc));
+                }
+
+                pFunc->~TFunc();
+            };
+        }
+
+        template <typename TFunc, typename TArg>
+        void Construct(TArg&& func, std::false_type /*isInline*/)
+        {
+            *reinterpret_cast<TFunc**>(&m_Storage) = new TFunc(std::forward<TArg>(func));
+
+            m_pInvoke = [] (void* pvStorage, V8IsolateImpl* pIsolateImpl)
+            {
+                (**static_cast<TFunc**>(pvStorage))(pIsolateImpl);
+            };
+
+            m_pManage = [] (void* pvStorage, void* pvTarget)
+            {
+                auto ppFunc = static_cast<TFunc**>(pvStorage);
+                if (pvTarget != nullptr)
+                {
+                    *static_cast<TFunc**>(pvTarget) = *ppFunc;
+                }
+                else
+                {
+                    delete *ppFunc;
+                }
+            };
+        }
+
+        void MoveFrom(Callback& that)
+        {
+            if (that.m_pManage != nullptr)
+            {
+                that.m_pManage(&that.m_Storage, &m_Storage);
+                m_pInvoke = that.m_pInvoke;
+                m_pManage = that.m_pManage;
+                that.m_pInvoke = nullptr;
+                that.m_pManage = nullptr;
+            }
+        }
+
+        Storage m_Storage;
+        InvokeFunc m_pInvoke;
+        ManageFunc m_pManage;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // bucket 0 counts latencies under 1 us; bucket N counts latencies in [2^(N-1), 2^N) us
+    static const size_t LatencyBucketCount = 24;
+
+    V8CallWithLockQueue();
+
+    void Enqueue(Callback&& callback);
+    bool TryDequeue(Callback& callback);
+    bool IsEmpty() const;
+    void GetLatencyHistogram(std::vector<std::uint64_t>& histogram) const;
+
+    ~V8CallWithLockQueue();
+
+private:
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Cell
+    {
+        std::atomic<size_t> Sequence;
+        Callback Func;
+        Clock::time_point EnqueueTime;
+    };
+
+    struct OverflowEntry
+    {
+        Callback Func;
+        Clock::time_point EnqueueTime;
+    };
+
+    bool TryEnqueue(Callback& callback, Clock::time_point enqueueTime);
+    void RecordLatency(Clock::time_point enqueueTime);
+
+    std::unique_ptr<Cell[]> m_spCells;
+    std::atomic<size_t> m_EnqueuePosition;
+    size_t m_DequeuePosition;
+
+    SimpleMutex m_OverflowMutex;
+    std::queue<OverflowEntry> m_OverflowQueue;
+    std::atomic<size_t> m_OverflowCount;
+
+    std::atomic<std::uint64_t> m_LatencyHistogram[LatencyBucketCount];
+};
@@ -0,0 +1,295 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Native.h"
+#include <windows.h>
+#include <bcrypt.h>
+
+//-----------------------------------------------------------------------------
+// local helper types and functions
+//-----------------------------------------------------------------------------
+
+// The header size is a multiple of the pointer size so that the cache data that follows it in
+// a mapped view remains suitably aligned for direct consumption by V8. The 64-bit key only
+// names the entry's file; the SHA-256 code hash is what ties the entry to its source code.
+
+struct V8CodeCacheHeader
+{
+    std::uint32_t Magic;
+    std::uint32_t VersionTag;
+    std::uint64_t Key;
+    std::uint32_t CodeLength;
+    std::uint32_t DataSize;
+    std::uint8_t CodeHash[32];
+};
+
+static_assert((sizeof(V8CodeCacheHeader) % sizeof(void*)) == 0, "V8CodeCacheHeader breaks cache data alignment");
+
+//-----------------------------------------------------------------------------
+
+static const std::uint32_t s_Magic = 0x32434356; // "VCC2"
+static const std::uint64_t s_FnvOffsetBasis = 0xCBF29CE484222325ULL;
+static const std::uint64_t s_FnvPrime = 0x00000100000001B3ULL;
+
+//-----------------------------------------------------------------------------
+
+static std::uint64_t HashBytes(std::uint64_t hash, const void* pvData, size_t size)
+{
+    auto pData = static_cast<const std::uint8_t*>(pvData);
+    for (size_t index = 0; index < size; index++)
+    {
+        hash = (hash ^ pData[index]) * s_FnvPrime;
+    }
+
+    return hash;
+}
+
+//-----------------------------------------------------------------------------
+
+static std::uint64_t HashString(std::uint64_t hash, const StdString& value)
+{
+    auto length = value.GetLength();
+    hash = HashBytes(hash, &length, sizeof length);
+    return HashBytes(hash, value.ToCString(), length * sizeof(wchar_t));
+}
+
+//-----------------------------------------------------------------------------
+
+static bool TryGetCodeHash(const StdString& code, std::uint8_t (&hash)[32])
+{
+    // the algorithm provider is opened once and shared; BCrypt handles are thread-safe
+
+    static const BCRYPT_ALG_HANDLE s_hAlgorithm = []
+    {
+        BCRYPT_ALG_HANDLE hAlgorithm = nullptr;
+        return BCRYPT_SUCCESS(::BCryptOpenAlgorithmProvider(&hAlgorithm, BCRYPT_SHA256_ALGORITHM, nullptr, 0)) ? hAlgorithm : nullptr;
+    }();
+
+    if (s_hAlgorithm == nullptr)
+    {
+        return false;
+    }
+
+    BCRYPT_HASH_HANDLE hHash = nullptr;
+    if (!BCRYPT_SUCCESS(::BCryptCreateHash(s_hAlgorithm, &hHash, nullptr, 0, nullptr, 0, 0)))
+    {
+        return false;
+    }
+
+    auto pCode = reinterpret_cast<PUCHAR>(const_cast<wchar_t*>(code.ToCString()));
+    auto succeeded = BCRYPT_SUCCESS(::BCryptHashData(hHash, pCode, static_cast<ULONG>(code.GetLength() * sizeof(wchar_t)), 0)) && BCRYPT_SUCCESS(::BCryptFinishHash(hHash, hash, sizeof hash, 0));
+    ::BCryptDestroyHash(hHash);
+    return succeeded;
+}
+
+//-----------------------------------------------------------------------------
+// V8CodeCacheStore::View implementation
+//-----------------------------------------------------------------------------
+
+V8CodeCacheStore::View::View():
+    m_pvBase(nullptr),
+    m_pData(nullptr),
+    m_Size(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void V8CodeCacheStore::View::Reset()
+{
+    if (m_pvBase != nullptr)
+    {
+        ::UnmapViewOfFile(m_pvBase);
+        m_pvBase = nullptr;
+    }
+
+    m_pData = nullptr;
+    m_Size = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+V8CodeCacheStore::View::~View()
+{
+    Reset();
+}
+
+//-----------------------------------------------------------------------------
+// V8CodeCacheStore implementation
+//-----------------------------------------------------------------------------
+
+V8CodeCacheStore::V8CodeCacheStore(const StdString& directoryPath):
+    m_DirectoryPath(directoryPath),
+    m_VersionTag(v8::ScriptCompiler::CachedDataVersionTag()),
+    m_HitCount(0),
+    m_MissCount(0),
+    m_AcceptedCount(0),
+    m_RejectedCount(0),
+    m_StoredCount(0)
+{
+    auto length = m_DirectoryPath.GetLength();
+    if ((length > 0) && (m_DirectoryPath.ToCString()[length - 1] != L'\\') && (m_DirectoryPath.ToCString()[length - 1] != L'/'))
+    {
+        m_DirectoryPath += L'\\';
+    }
+
+    ::CreateDirectoryW(m_DirectoryPath.ToCString(), nullptr);
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8CodeCacheStore::Contains(const StdString& code) const
+{
+    // an existence check only; TryOpen validates the entry and records the outcome
+
+    return ::GetFileAttributesW(GetFilePath(GetKey(code)).ToCString()) != INVALID_FILE_ATTRIBUTES;
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8CodeCacheStore::TryOpen(const StdString& code, View& view)
+{
+    view.Reset();
+
+    std::uint8_t codeHash[32];
+    if (!TryGetCodeHash(code, codeHash))
+    {
+        ++m_MissCount;
+        return false;
+    }
+
+    auto key = GetKey(code);
+    auto hFile = ::CreateFileW(GetFilePath(key).ToCString(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        ++m_MissCount;
+        return false;
+    }
+
+    const void* pvBase = nullptr;
+
+    std::uint64_t fileSize = 0;
+    LARGE_INTEGER tempFileSize;
+    if (::GetFileSizeEx(hFile, &tempFileSize))
+    {
+        fileSize = static_cast<std::uint64_t>(tempFileSize.QuadPart);
+    }
+
+    if ((fileSize > sizeof(V8CodeCacheHeader)) && (fileSize <= INT_MAX))
+    {
+        auto hMapping = ::CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (hMapping != nullptr)
+        {
+            // the view keeps the mapping alive after both handles are closed
+            pvBase = ::MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+            ::CloseHandle(hMapping);
+        }
+    }
+
+    ::CloseHandle(hFile);
+
+    if (pvBase != nullptr)
+    {
+        auto pHeader = static_cast<const V8CodeCacheHeader*>(pvBase);
+        if ((pHeader->Magic == s_Magic) && (pHeader->VersionTag == m_VersionTag) && (pHeader->Key == key) && (pHeader->CodeLength == static_cast<std::uint32_t>(code.GetLength())) && (pHeader->DataSize == (fileSize - sizeof(V8CodeCacheHeader))) && (memcmp(pHeader->CodeHash, codeHash, sizeof codeHash) == 0))
+        {
+            view.m_pvBase = pvBase;
+            view.m_pData = static_cast<const std::uint8_t*>(pvBase) + sizeof(V8CodeCacheHeader);
+            view.m_Size = static_cast<int>(pHeader->DataSize);
+
+            ++m_HitCount;
+            return true;
+        }
+
+        ::UnmapViewOfFile(pvBase);
+    }
+
+    ++m_MissCount;
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8CodeCacheStore::Store(const StdString& code, const std::uint8_t* pData, int size)
+{
+    if ((pData == nullptr) || (size < 1))
+    {
+        return;
+    }
+
+    V8CodeCacheHeader header = {};
+    if (!TryGetCodeHash(code, header.CodeHash))
+    {
+        return;
+    }
+
+    auto key = GetKey(code);
+    auto filePath = GetFilePath(key);
+
+    // Write to a private temporary file and rename it into place so that concurrent readers,
+    // including other processes sharing the directory, never observe a partial entry.
+
+    wchar_t suffix[32];
+    swprintf_s(suffix, L".%lx.%lx.tmp", ::GetCurrentProcessId(), ::GetCurrentThreadId());
+
+    auto tempFilePath = filePath;
+    tempFilePath += suffix;
+
+    auto hFile = ::CreateFileW(tempFilePath.ToCString(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    header.Magic = s_Magic;
+    header.VersionTag = m_VersionTag;
+    header.Key = key;
+    header.CodeLength = static_cast<std::uint32_t>(code.GetLength());
+    header.DataSize = static_cast<std::uint32_t>(size);
+
+    DWORD headerBytesWritten = 0;
+    DWORD dataBytesWritten = 0;
+    auto succeeded = ::WriteFile(hFile, &header, sizeof header, &headerBytesWritten, nullptr) && (headerBytesWritten == sizeof header) && ::WriteFile(hFile, pData, static_cast<DWORD>(size), &dataBytesWritten, nullptr) && (dataBytesWritten == static_cast<DWORD>(size));
+    ::CloseHandle(hFile);
+
+    if (succeeded && ::MoveFileExW(tempFilePath.ToCString(), filePath.ToCString(), MOVEFILE_REPLACE_EXISTING))
+    {
+        ++m_StoredCount;
+    }
+    else
+    {
+        ::DeleteFileW(tempFilePath.ToCString());
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+
+void V8CodeCacheStore::GetInfo(V8IsolateCodeCacheInfo& codeCacheInfo) const
+{
+    codeCacheInfo.Set(m_HitCount, m_MissCount, m_AcceptedCount, m_RejectedCount, m_StoredCount);
+}
+
+//-----------------------------------------------------------------------------
+
+std::uint64_t V8CodeCacheStore::GetKey(const StdString& code) const
+{
+    // The version tag reflects both the V8 version and the V8 flags that affect code
+    // generation; an entry produced under different flags is simply never found. Resource names
+    // are deliberately excluded, as ClearScript makes them unique per runtime. The key is not
+    // collision-resistant; TryOpen also compares the entry's SHA-256 code hash.
+
+    return HashString(HashBytes(s_FnvOffsetBasis, &m_VersionTag, sizeof m_VersionTag), code);
+}
+
+//-----------------------------------------------------------------------------
+
+StdString V8CodeCacheStore::GetFilePath(std::uint64_t key) const
+{
+    wchar_t fileName[32];
+    swprintf_s(fileName, L"%016llx.v8cache", key);
+
+    auto filePath = m_DirectoryPath;
+    filePath += fileName;
+    return filePath;
+}
@@ -0,0 +1,67 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8CodeCacheStore
+//-----------------------------------------------------------------------------
+
+class V8CodeCacheStore: public SharedPtrTarget
+{
+    PROHIBIT_COPY(V8CodeCacheStore)
+
+public:
+
+    class View
+    {
+        PROHIBIT_COPY(View)
+        PROHIBIT_HEAP(View)
+
+    public:
+
+        View();
+
+        const std::uint8_t* GetData() const { return m_pData; }
+        int GetSize() const { return m_Size; }
+        bool IsEmpty() const { return m_pData == nullptr; }
+
+        ~View();
+
+    private:
+
+        friend class V8CodeCacheStore;
+
+        void Reset();
+
+        const void* m_pvBase;
+        const std::uint8_t* m_pData;
+        int m_Size;
+    };
+
+    explicit V8CodeCacheStore(const StdString& directoryPath);
+
+    const StdString& GetDirectoryPath() const { return m_DirectoryPath; }
+
+    bool TryOpen(const StdString& code, View& view);
+    bool Contains(const StdString& code) const;
+    void Store(const StdString& code, const std::uint8_t* pData, int size);
+
+    void RecordMiss() { ++m_MissCount; }
+    void RecordAccepted() { ++m_AcceptedCount; }
+    void RecordRejected() { ++m_RejectedCount; }
+    void GetInfo(V8IsolateCodeCacheInfo& codeCacheInfo) const;
+
+private:
+
+    std::uint64_t GetKey(const StdString& code) const;
+    StdString GetFilePath(std::uint64_t key) const;
+
+    StdString m_DirectoryPath;
+    std::uint32_t m_VersionTag;
+    std::atomic<size_t> m_HitCount;
+    std::atomic<size_t> m_MissCount;
+    std::atomic<size_t> m_AcceptedCount;
+    std::atomic<size_t> m_RejectedCount;
+    std::atomic<size_t> m_StoredCount;
+};
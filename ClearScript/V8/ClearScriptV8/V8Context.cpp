@@ -18,3 +18,17 @@ size_t V8Context::GetInstanceCount()
 {
     return V8ContextImpl::GetInstanceCount();
 }
+
+//-----------------------------------------------------------------------------
+
+std::uint64_t V8Context::GetHostTypeTemplateCount()
+{
+    return V8ContextImpl::GetHostTypeTemplateCount();
+}
+
+//-----------------------------------------------------------------------------
+
+std::uint64_t V8Context::GetHostPropertyFetchCount()
+{
+    return V8ContextImpl::GetHostPropertyFetchCount();
+}
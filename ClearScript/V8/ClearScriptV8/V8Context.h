@@ -22,11 +22,15 @@ public:
 
     static V8Context* Create(const SharedPtr<V8Isolate>& spIsolate, const StdString& name, const Options& options);
     static size_t GetInstanceCount();
+    static std::uint64_t GetHostTypeTemplateCount();
+    static std::uint64_t GetHostPropertyFetchCount();
 
     virtual size_t GetMaxIsolateHeapSize() = 0;
     virtual void SetMaxIsolateHeapSize(size_t value) = 0;
     virtual double GetIsolateHeapSizeSampleInterval() = 0;
     virtual void SetIsolateHeapSizeSampleInterval(double value) = 0;
+    virtual double GetIsolateTimeSliceInterval() = 0;
+    virtual void SetIsolateTimeSliceInterval(double value) = 0;
 
     virtual size_t GetMaxIsolateStackUsage() = 0;
     virtual void SetMaxIsolateStackUsage(size_t value) = 0;
@@ -43,13 +47,29 @@ public:
     virtual V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code) = 0;
     virtual V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code, V8CacheType cacheType, std::vector<std::uint8_t>& cacheBytes) = 0;
     virtual V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code, V8CacheType cacheType, const std::vector<std::uint8_t>& cacheBytes, bool& cacheAccepted) = 0;
+    virtual SharedPtr<V8ScriptCompilation> CompileAsync(const V8DocumentInfo& documentInfo, const StdString& code) = 0;
     virtual bool CanExecute(V8ScriptHolder* pHolder) = 0;
     virtual V8Value Execute(V8ScriptHolder* pHolder, bool evaluate) = 0;
+    virtual void CreateCacheBytes(V8ScriptHolder* pHolder, std::vector<std::uint8_t>& cacheBytes) = 0;
+
+    virtual V8Value ParseJson(const char* pJson, size_t size) = 0;
+    virtual void StringifyJson(const V8Value& value, std::string& json) = 0;
+
+    virtual V8Value CreatePromise(V8Value& resolver) = 0;
+    virtual void SettlePromiseAsync(const SharedPtr<V8ObjectHolder>& spResolverHolder, bool resolve, const V8Value& value) = 0;
+
+    typedef std::function<void()> ArrayBufferReleaseCallback;
+    virtual V8Value CreateExternalArrayBuffer(void* pvData, size_t size, ArrayBufferReleaseCallback&& releaseCallback) = 0;
 
     virtual void Interrupt() = 0;
     virtual void GetIsolateHeapInfo(V8IsolateHeapInfo& heapInfo) = 0;
+    virtual void GetIsolateHeapInfoSnapshot(V8IsolateHeapInfo& heapInfo) = 0;
     virtual void CollectGarbage(bool exhaustive) = 0;
+    virtual void NotifyIdle(double idleTimeInSeconds) = 0;
+    virtual void DrainMicrotasks(double timeBudgetInSeconds) = 0;
     virtual void OnAccessSettingsChanged() = 0;
+    virtual void CaptureResetBaseline() = 0;
+    virtual void Reset() = 0;
 
     virtual void Destroy() = 0;
 
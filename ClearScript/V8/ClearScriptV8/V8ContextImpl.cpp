@@ -19,6 +19,47 @@ class FromMaybeFailure
 {
 };
 
+//-----------------------------------------------------------------------------
+// ObjectGraphFailure
+//-----------------------------------------------------------------------------
+
+class ObjectGraphFailure
+{
+public:
+
+    explicit ObjectGraphFailure(const wchar_t* pMessage):
+        m_pMessage(pMessage)
+    {
+    }
+
+    const wchar_t* GetDescription() const
+    {
+        return m_pMessage;
+    }
+
+private:
+
+    const wchar_t* m_pMessage;
+};
+
+//-----------------------------------------------------------------------------
+// ObjectGraphTag
+//-----------------------------------------------------------------------------
+
+// IMPORTANT: maintain bitwise equivalence with managed enum V8ObjectGraph.Tag
+enum class ObjectGraphTag: std::uint8_t
+{
+    Undefined,
+    Null,
+    False,
+    True,
+    Int32,
+    Number,
+    String,
+    Array,
+    Object
+};
+
 //-----------------------------------------------------------------------------
 // local helper functions
 //-----------------------------------------------------------------------------
@@ -88,6 +129,44 @@ inline v8::Local<v8::External> ValueAsExternal(const v8::Local<v8::Value>& hValu
 
 //-----------------------------------------------------------------------------
 
+static size_t ExtendGraph(std::vector<std::uint8_t>& graph, size_t maxSize, size_t size)
+{
+    auto offset = graph.size();
+    if ((size > maxSize) || (offset > (maxSize - size)))
+    {
+        throw ObjectGraphFailure(L"The object graph exceeds the maximum export size");
+    }
+
+    graph.resize(offset + size);
+    return offset;
+}
+
+//-----------------------------------------------------------------------------
+
+static void WriteGraphBytes(std::vector<std::uint8_t>& graph, size_t maxSize, const void* pvData, size_t size)
+{
+    auto offset = ExtendGraph(graph, maxSize, size);
+    memcpy(&graph[offset], pvData, size);
+}
+
+//-----------------------------------------------------------------------------
+
+static void WriteGraphTag(std::vector<std::uint8_t>& graph, size_t maxSize, ObjectGraphTag tag)
+{
+    WriteGraphBytes(graph, maxSize, &tag, sizeof tag);
+}
+
+//-----------------------------------------------------------------------------
+
+template <typename T>
+static void WriteGraphValue(std::vector<std::uint8_t>& graph, size_t maxSize, ObjectGraphTag tag, T value)
+{
+    WriteGraphTag(graph, maxSize, tag);
+    WriteGraphBytes(graph, maxSize, &value, sizeof value);
+}
+
+//-----------------------------------------------------------------------------
+
 template <typename TInfo>
 static V8ContextImpl* GetContextImplFromHolder(const TInfo& info)
 {
@@ -199,6 +278,9 @@ static V8ContextImpl* GetContextImplFromData(const TInfo& info)
 //-----------------------------------------------------------------------------
 
 static std::atomic<size_t> s_InstanceCount(0);
+static std::atomic<std::uint64_t> s_HostTypeTemplateCount(0);
+static std::atomic<std::uint64_t> s_HostPropertyFetchCount(0);
+static const size_t s_MaxHostTypeTemplateCount = 1024;
 
 //-----------------------------------------------------------------------------
 
@@ -323,6 +405,64 @@ size_t V8ContextImpl::GetInstanceCount()
 
 //-----------------------------------------------------------------------------
 
+std::uint64_t V8ContextImpl::GetHostTypeTemplateCount()
+{
+    return s_HostTypeTemplateCount;
+}
+
+//-----------------------------------------------------------------------------
+
+std::uint64_t V8ContextImpl::GetHostPropertyFetchCount()
+{
+    return s_HostPropertyFetchCount;
+}
+
+//-----------------------------------------------------------------------------
+
+const intptr_t* V8ContextImpl::GetExternalReferences()
+{
+    // Snapshot serialization and deserialization require every native callback that a
+    // snapshot may reference to be registered here. The list must be null-terminated, and
+    // its order must not change between snapshot creation and consumption.
+
+    static const intptr_t s_ExternalReferences[] =
+    {
+        reinterpret_cast<intptr_t>(static_cast<v8::GenericNamedPropertyGetterCallback>(GetGlobalProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::GenericNamedPropertySetterCallback>(SetGlobalProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::GenericNamedPropertyQueryCallback>(QueryGlobalProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::GenericNamedPropertyDeleterCallback>(DeleteGlobalProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::GenericNamedPropertyEnumeratorCallback>(GetGlobalPropertyNames)),
+        reinterpret_cast<intptr_t>(static_cast<v8::IndexedPropertyGetterCallback>(GetGlobalProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::IndexedPropertySetterCallback>(SetGlobalProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::IndexedPropertyQueryCallback>(QueryGlobalProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::IndexedPropertyDeleterCallback>(DeleteGlobalProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::IndexedPropertyEnumeratorCallback>(GetGlobalPropertyIndices)),
+        reinterpret_cast<intptr_t>(static_cast<v8::FunctionCallback>(HostObjectConstructorCallHandler)),
+        reinterpret_cast<intptr_t>(static_cast<v8::FunctionCallback>(GetIteratorForHostObject)),
+        reinterpret_cast<intptr_t>(static_cast<v8::FunctionCallback>(AdvanceHostObjectIterator)),
+        reinterpret_cast<intptr_t>(static_cast<v8::FunctionCallback>(CreateFunctionForHostDelegate)),
+        reinterpret_cast<intptr_t>(static_cast<v8::FunctionCallback>(InvokeHostDelegate)),
+        reinterpret_cast<intptr_t>(static_cast<v8::GenericNamedPropertyGetterCallback>(GetHostObjectProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::GenericNamedPropertySetterCallback>(SetHostObjectProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::GenericNamedPropertyQueryCallback>(QueryHostObjectProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::GenericNamedPropertyDeleterCallback>(DeleteHostObjectProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::GenericNamedPropertyEnumeratorCallback>(GetHostObjectPropertyNames)),
+        reinterpret_cast<intptr_t>(static_cast<v8::IndexedPropertyGetterCallback>(GetHostObjectProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::IndexedPropertySetterCallback>(SetHostObjectProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::IndexedPropertyQueryCallback>(QueryHostObjectProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::IndexedPropertyDeleterCallback>(DeleteHostObjectProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::IndexedPropertyEnumeratorCallback>(GetHostObjectPropertyIndices)),
+        reinterpret_cast<intptr_t>(static_cast<v8::FunctionCallback>(InvokeHostObject)),
+        reinterpret_cast<intptr_t>(static_cast<v8::AccessorNameGetterCallback>(GetCachedHostObjectProperty)),
+        reinterpret_cast<intptr_t>(static_cast<v8::AccessorNameSetterCallback>(SetCachedHostObjectProperty)),
+        0
+    };
+
+    return s_ExternalReferences;
+}
+
+//-----------------------------------------------------------------------------
+
 size_t V8ContextImpl::GetMaxIsolateHeapSize()
 {
     return m_spIsolateImpl->GetMaxHeapSize();
@@ -351,6 +491,20 @@ void V8ContextImpl::SetIsolateHeapSizeSampleInterval(double value)
 
 //-----------------------------------------------------------------------------
 
+double V8ContextImpl::GetIsolateTimeSliceInterval()
+{
+    return m_spIsolateImpl->GetTimeSliceInterval();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::SetIsolateTimeSliceInterval(double value)
+{
+    m_spIsolateImpl->SetTimeSliceInterval(value);
+}
+
+//-----------------------------------------------------------------------------
+
 size_t V8ContextImpl::GetMaxIsolateStackUsage()
 {
     return m_spIsolateImpl->GetMaxStackUsage();
@@ -473,6 +627,24 @@ V8Value V8ContextImpl::Execute(const V8DocumentInfo& documentInfo, const StdStri
 
 V8ScriptHolder* V8ContextImpl::Compile(const V8DocumentInfo& documentInfo, const StdString& code)
 {
+    if (!m_spIsolateImpl->IsDebuggingEnabled())
+    {
+        // The process-wide shared script cache takes precedence over the isolate's code cache
+        // store; when it's enabled, compilation neither consults nor populates the store.
+
+        auto& sharedScriptCache = V8SharedScriptCacheImpl::GetInstance();
+        if (sharedScriptCache.IsEnabled())
+        {
+            return Compile(documentInfo, code, sharedScriptCache);
+        }
+
+        auto spCodeCacheStore = m_spIsolateImpl->GetCodeCacheStore();
+        if (!spCodeCacheStore.IsEmpty())
+        {
+            return Compile(documentInfo, code, spCodeCacheStore);
+        }
+    }
+
     BEGIN_CONTEXT_SCOPE
     BEGIN_EXECUTION_SCOPE
     FROM_MAYBE_TRY
@@ -511,8 +683,11 @@ V8ScriptHolder* V8ContextImpl::Compile(const V8DocumentInfo& documentInfo, const
 
         auto hCode = FROM_MAYBE(CreateString(code));
 
+        // Eager compilation makes the cache data cover all functions rather than just those
+        // that V8 compiles up front.
+
         v8::ScriptCompiler::Source source(hCode, CreateScriptOrigin(documentInfo));
-        auto hScript = VERIFY_MAYBE(CreateUnboundScript(&source));
+        auto hScript = VERIFY_MAYBE(CreateUnboundScript(&source, (cacheType == V8CacheType::EagerCode) ? v8::ScriptCompiler::kEagerCompile : v8::ScriptCompiler::kNoCompileOptions));
         if (hScript.IsEmpty())
         {
             throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"Script compilation failed; no additional information was provided by the V8 runtime"), false /*executionStarted*/);
@@ -585,85 +760,706 @@ V8ScriptHolder* V8ContextImpl::Compile(const V8DocumentInfo& documentInfo, const
 
 //-----------------------------------------------------------------------------
 
-bool V8ContextImpl::CanExecute(V8ScriptHolder* pHolder)
+V8ScriptHolder* V8ContextImpl::Compile(const V8DocumentInfo& documentInfo, const StdString& code, const SharedPtr<V8CodeCacheStore>& spCodeCacheStore)
 {
-    return pHolder->IsSameIsolate(m_spIsolateImpl.GetRawPtr());
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+    FROM_MAYBE_TRY
+
+        auto hCode = FROM_MAYBE(CreateString(code));
+        v8::Local<v8::UnboundScript> hScript;
+        bool cacheRejected = false;
+
+        {
+            V8CodeCacheStore::View view;
+            if (spCodeCacheStore->TryOpen(code, view))
+            {
+                // V8 consumes the cache data directly from the mapped view
+                auto pCachedData = new v8::ScriptCompiler::CachedData(view.GetData(), view.GetSize(), v8::ScriptCompiler::CachedData::BufferNotOwned);
+                v8::ScriptCompiler::Source source(hCode, CreateScriptOrigin(documentInfo), pCachedData);
+
+                hScript = VERIFY_MAYBE(CreateUnboundScript(&source, v8::ScriptCompiler::kConsumeCodeCache));
+                if (hScript.IsEmpty())
+                {
+                    throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"Script compilation failed; no additional information was provided by the V8 runtime"), false /*executionStarted*/);
+                }
+
+                cacheRejected = pCachedData->rejected;
+                if (cacheRejected)
+                {
+                    spCodeCacheStore->RecordRejected();
+                }
+                else
+                {
+                    spCodeCacheStore->RecordAccepted();
+                }
+            }
+        }
+
+        if (hScript.IsEmpty() || cacheRejected)
+        {
+            if (hScript.IsEmpty())
+            {
+                v8::ScriptCompiler::Source source(hCode, CreateScriptOrigin(documentInfo));
+                hScript = VERIFY_MAYBE(CreateUnboundScript(&source));
+                if (hScript.IsEmpty())
+                {
+                    throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"Script compilation failed; no additional information was provided by the V8 runtime"), false /*executionStarted*/);
+                }
+            }
+
+            // a rejected entry is replaced with fresh cache data for the current V8 configuration
+
+            auto pCachedData = v8::ScriptCompiler::CreateCodeCache(hScript);
+            if (pCachedData != nullptr)
+            {
+                spCodeCacheStore->Store(code, pCachedData->data, pCachedData->length);
+                pCachedData->Delete();
+            }
+        }
+
+        return new V8ScriptHolderImpl(GetWeakBinding(), ::PtrFromHandle(CreatePersistent(hScript)));
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The V8 runtime cannot perform the requested operation because a script exception is pending"), EXECUTION_STARTED);
+
+    FROM_MAYBE_END
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
 }
 
 //-----------------------------------------------------------------------------
 
-V8Value V8ContextImpl::Execute(V8ScriptHolder* pHolder, bool evaluate)
+V8ScriptHolder* V8ContextImpl::Compile(const V8DocumentInfo& documentInfo, const StdString& code, V8SharedScriptCacheImpl& sharedScriptCache)
 {
     BEGIN_CONTEXT_SCOPE
     BEGIN_EXECUTION_SCOPE
+    FROM_MAYBE_TRY
 
-        auto hScript = ::HandleFromPtr<v8::UnboundScript>(pHolder->GetScript());
-        auto hResult = VERIFY_MAYBE(hScript->BindToCurrentContext()->Run(m_hContext));
-        if (!evaluate)
+        v8::Local<v8::UnboundScript> hScript;
+
+        auto spSharedScript = sharedScriptCache.Find(code);
+        if (!spSharedScript.IsEmpty())
         {
-            hResult = GetUndefined();
+            hScript = VERIFY_MAYBE(GetSharedScript(documentInfo, code, spSharedScript));
+            if (hScript.IsEmpty())
+            {
+                throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"Script compilation failed; no additional information was provided by the V8 runtime"), false /*executionStarted*/);
+            }
         }
+        else
+        {
+            v8::ScriptCompiler::Source source(FROM_MAYBE(CreateString(code)), CreateScriptOrigin(documentInfo));
+            hScript = VERIFY_MAYBE(CreateUnboundScript(&source));
+            if (hScript.IsEmpty())
+            {
+                throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"Script compilation failed; no additional information was provided by the V8 runtime"), false /*executionStarted*/);
+            }
 
-        return ExportValue(hResult);
+            std::vector<std::uint8_t> cacheBytes;
+            auto pCachedData = v8::ScriptCompiler::CreateCodeCache(hScript);
+            if (pCachedData != nullptr)
+            {
+                if ((pCachedData->length > 0) && (pCachedData->data != nullptr))
+                {
+                    cacheBytes.assign(pCachedData->data, pCachedData->data + pCachedData->length);
+                }
+
+                pCachedData->Delete();
+            }
+
+            spSharedScript = sharedScriptCache.Add(documentInfo, code, std::move(cacheBytes));
+            m_spIsolateImpl->AddSharedScript(spSharedScript, documentInfo.ResourceName, hScript);
+        }
+
+        return new V8ScriptHolderImpl(GetWeakBinding(), ::PtrFromHandle(CreatePersistent(hScript)), spSharedScript);
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The V8 runtime cannot perform the requested operation because a script exception is pending"), EXECUTION_STARTED);
 
+    FROM_MAYBE_END
     END_EXECUTION_SCOPE
     END_CONTEXT_SCOPE
 }
 
 //-----------------------------------------------------------------------------
 
-void V8ContextImpl::Interrupt()
+v8::MaybeLocal<v8::UnboundScript> V8ContextImpl::GetSharedScript(const V8DocumentInfo& documentInfo, const StdString& code, const SharedPtr<V8SharedScript>& spSharedScript)
 {
-    TerminateExecution();
+    // A shared script is instantiated at most once per isolate and document name, from the cache
+    // data produced by the isolate that first compiled it. The document name is part of the
+    // unbound script, so callers compiling the same code under different names don't share one.
+
+    v8::Local<v8::UnboundScript> hScript;
+    if (m_spIsolateImpl->TryGetSharedScript(spSharedScript->GetId(), documentInfo.ResourceName, hScript))
+    {
+        return hScript;
+    }
+
+    v8::Local<v8::String> hCode;
+    if (!CreateString(code).ToLocal(&hCode))
+    {
+        return v8::MaybeLocal<v8::UnboundScript>();
+    }
+
+    const auto& cacheBytes = spSharedScript->GetCacheBytes();
+    if (cacheBytes.size() < 1)
+    {
+        v8::ScriptCompiler::Source source(hCode, CreateScriptOrigin(documentInfo));
+        if (!CreateUnboundScript(&source).ToLocal(&hScript))
+        {
+            return v8::MaybeLocal<v8::UnboundScript>();
+        }
+    }
+    else
+    {
+        auto pCachedData = new v8::ScriptCompiler::CachedData(&cacheBytes[0], static_cast<int>(cacheBytes.size()), v8::ScriptCompiler::CachedData::BufferNotOwned);
+        v8::ScriptCompiler::Source source(hCode, CreateScriptOrigin(documentInfo), pCachedData);
+        if (!CreateUnboundScript(&source, v8::ScriptCompiler::kConsumeCodeCache).ToLocal(&hScript))
+        {
+            return v8::MaybeLocal<v8::UnboundScript>();
+        }
+    }
+
+    V8SharedScriptCacheImpl::GetInstance().RecordInstantiation();
+    m_spIsolateImpl->AddSharedScript(spSharedScript, documentInfo.ResourceName, hScript);
+    return hScript;
 }
 
 //-----------------------------------------------------------------------------
 
-void V8ContextImpl::GetIsolateHeapInfo(V8IsolateHeapInfo& heapInfo)
+v8::MaybeLocal<v8::UnboundScript> V8ContextImpl::GetUnboundScript(V8ScriptHolder* pHolder)
 {
-    m_spIsolateImpl->GetHeapInfo(heapInfo);
+    if (pHolder->IsSameIsolate(m_spIsolateImpl.GetRawPtr()))
+    {
+        return ::HandleFromPtr<v8::UnboundScript>(pHolder->GetScript());
+    }
+
+    const auto& spSharedScript = static_cast<V8ScriptHolderImpl*>(pHolder)->GetSharedScript();
+    return GetSharedScript(spSharedScript->GetDocumentInfo(), spSharedScript->GetCode(), spSharedScript);
 }
 
 //-----------------------------------------------------------------------------
 
-void V8ContextImpl::CollectGarbage(bool exhaustive)
+SharedPtr<V8ScriptCompilation> V8ContextImpl::CompileAsync(const V8DocumentInfo& documentInfo, const StdString& code)
 {
-    m_spIsolateImpl->CollectGarbage(exhaustive);
+    SharedPtr<V8ScriptCompilationImpl> spCompilation(new V8ScriptCompilationImpl(documentInfo, code));
+
+    // Thread-affine isolates compile synchronously, as the final compilation step can't run on
+    // another thread. So do scripts with a code cache entry, as consuming it beats streaming.
+
+    auto spCodeCacheStore = m_spIsolateImpl->GetCodeCacheStore();
+    if (!m_spIsolateImpl->IsDebuggingEnabled() && !m_spIsolateImpl->IsThreadAffine() && (spCodeCacheStore.IsEmpty() || !spCodeCacheStore->Contains(code)) && !V8SharedScriptCacheImpl::GetInstance().IsEnabled())
+    {
+        BEGIN_CONTEXT_SCOPE
+            spCompilation->SetStreamingTask(StartStreamingScript(spCompilation->GetStreamedSource()));
+        END_CONTEXT_SCOPE
+
+        // The background task holds a strong context reference; the context (and therefore the
+        // isolate) can't be torn down before the final compilation step.
+
+        SharedPtr<V8ContextImpl> spThis(this);
+        HostObjectHelpers::QueueNativeCallback([spThis, spCompilation] ()
+        {
+            spCompilation->RunStreamingTask();
+
+            try
+            {
+                spCompilation->Complete(spThis->Compile(spCompilation->GetDocumentInfo(), spCompilation->GetCode(), spCompilation->GetStreamedSource()));
+            }
+            catch (const V8Exception& exception)
+            {
+                spCompilation->Complete(exception);
+            }
+        });
+
+        return SharedPtr<V8ScriptCompilation>(spCompilation);
+    }
+
+    try
+    {
+        spCompilation->Complete(Compile(documentInfo, code));
+    }
+    catch (const V8Exception& exception)
+    {
+        spCompilation->Complete(exception);
+    }
+
+    return SharedPtr<V8ScriptCompilation>(spCompilation);
+}
+
+//-----------------------------------------------------------------------------
+
+V8ScriptHolder* V8ContextImpl::Compile(const V8DocumentInfo& documentInfo, const StdString& code, v8::ScriptCompiler::StreamedSource* pSource)
+{
+    // this is the only step of a streaming compilation that requires the isolate lock
+
+    BEGIN_ISOLATE_SCOPE
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+    FROM_MAYBE_TRY
+
+        auto hScript = VERIFY_MAYBE(v8::ScriptCompiler::Compile(m_hContext, pSource, FROM_MAYBE(CreateString(code)), CreateScriptOrigin(documentInfo)));
+        if (hScript.IsEmpty())
+        {
+            throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"Script compilation failed; no additional information was provided by the V8 runtime"), false /*executionStarted*/);
+        }
+
+        auto hUnboundScript = hScript->GetUnboundScript();
+
+        // streaming can't consume cache data, but its result can populate the code cache
+
+        auto spCodeCacheStore = m_spIsolateImpl->GetCodeCacheStore();
+        if (!spCodeCacheStore.IsEmpty())
+        {
+            spCodeCacheStore->RecordMiss();
+
+            auto pCachedData = v8::ScriptCompiler::CreateCodeCache(hUnboundScript);
+            if (pCachedData != nullptr)
+            {
+                spCodeCacheStore->Store(code, pCachedData->data, pCachedData->length);
+                pCachedData->Delete();
+            }
+        }
+
+        return new V8ScriptHolderImpl(GetWeakBinding(), ::PtrFromHandle(CreatePersistent(hUnboundScript)));
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The V8 runtime cannot perform the requested operation because a script exception is pending"), EXECUTION_STARTED);
+
+    FROM_MAYBE_END
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+    END_ISOLATE_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8ContextImpl::CanExecute(V8ScriptHolder* pHolder)
+{
+    // shared scripts can be executed in any isolate
+
+    return pHolder->IsSameIsolate(m_spIsolateImpl.GetRawPtr()) || !static_cast<V8ScriptHolderImpl*>(pHolder)->GetSharedScript().IsEmpty();
+}
+
+//-----------------------------------------------------------------------------
+
+V8Value V8ContextImpl::Execute(V8ScriptHolder* pHolder, bool evaluate)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+
+        auto hScript = VERIFY_MAYBE(GetUnboundScript(pHolder));
+        if (hScript.IsEmpty())
+        {
+            throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"Script compilation failed; no additional information was provided by the V8 runtime"), false /*executionStarted*/);
+        }
+
+        auto hResult = VERIFY_MAYBE(hScript->BindToCurrentContext()->Run(m_hContext));
+        if (!evaluate)
+        {
+            hResult = GetUndefined();
+        }
+
+        return ExportValue(hResult);
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::CreateCacheBytes(V8ScriptHolder* pHolder, std::vector<std::uint8_t>& cacheBytes)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+
+        auto hScript = VERIFY_MAYBE(GetUnboundScript(pHolder));
+        if (hScript.IsEmpty())
+        {
+            throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"Script compilation failed; no additional information was provided by the V8 runtime"), false /*executionStarted*/);
+        }
+
+        // The cache data includes every function compiled so far, so producing it after the
+        // script has run captures functions that V8 compiled lazily during execution.
+
+        cacheBytes.clear();
+        auto pCachedData = v8::ScriptCompiler::CreateCodeCache(hScript);
+        if (pCachedData != nullptr)
+        {
+            if ((pCachedData->length > 0) && (pCachedData->data != nullptr))
+            {
+                cacheBytes.assign(pCachedData->data, pCachedData->data + pCachedData->length);
+            }
+
+            pCachedData->Delete();
+        }
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+V8Value V8ContextImpl::ParseJson(const char* pJson, size_t size)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+
+        // V8 decodes the UTF-8 text directly; no intermediate wide string is created
+
+        v8::Local<v8::String> hJson;
+        if ((size > static_cast<size_t>(INT_MAX)) || !CreateStringFromUtf8(pJson, static_cast<int>(size)).ToLocal(&hJson))
+        {
+            throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The JSON text exceeds the maximum supported length"), false /*executionStarted*/);
+        }
+
+        return ExportValue(VERIFY_MAYBE(v8::JSON::Parse(m_hContext, hJson)));
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::StringifyJson(const V8Value& value, std::string& json)
+{
+    json.clear();
+
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+
+        auto hJson = VERIFY_MAYBE(v8::JSON::Stringify(m_hContext, ImportValue(value)));
+        if (!hJson.IsEmpty())
+        {
+            // the UTF-8 encoding is written directly into the caller's buffer
+            auto size = GetUtf8Length(hJson);
+            if (size > 0)
+            {
+                json.resize(size);
+                WriteUtf8(hJson, &json[0], size);
+            }
+        }
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+V8Value V8ContextImpl::CreatePromise(V8Value& resolver)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+
+        auto hResolver = VERIFY_MAYBE(v8::Promise::Resolver::New(m_hContext));
+        resolver = ExportValue(hResolver);
+        return ExportValue(hResolver->GetPromise());
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::SettlePromiseAsync(const SharedPtr<V8ObjectHolder>& spResolverHolder, bool resolve, const V8Value& value)
+{
+    // The settlement is applied under the isolate lock, possibly on another thread; the caller
+    // doesn't wait for it. The resolver holder keeps the resolver alive until then.
+
+    auto wrContext = CreateWeakRef();
+    m_spIsolateImpl->CallWithLockNoWait([wrContext, spResolverHolder, resolve, value] (V8IsolateImpl* /*pIsolateImpl*/)
+    {
+        auto spContext = wrContext.GetTarget();
+        if (!spContext.IsEmpty())
+        {
+            try
+            {
+                static_cast<V8ContextImpl*>(spContext.GetRawPtr())->SettleV8Promise(spResolverHolder->GetObject(), resolve, value);
+            }
+            catch (const V8Exception&)
+            {
+                // there's no caller to receive the exception
+            }
+        }
+    });
+}
+
+//-----------------------------------------------------------------------------
+
+V8Value V8ContextImpl::CreateExternalArrayBuffer(void* pvData, size_t size, ArrayBufferReleaseCallback&& releaseCallback)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+
+        return ExportValue(m_spIsolateImpl->CreateExternalArrayBuffer(pvData, size, std::move(releaseCallback)));
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::Interrupt()
+{
+    TerminateExecution();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::GetIsolateHeapInfo(V8IsolateHeapInfo& heapInfo)
+{
+    m_spIsolateImpl->GetHeapInfo(heapInfo);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::GetIsolateHeapInfoSnapshot(V8IsolateHeapInfo& heapInfo)
+{
+    m_spIsolateImpl->GetHeapInfoSnapshot(heapInfo);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::CollectGarbage(bool exhaustive)
+{
+    m_spIsolateImpl->CollectGarbage(exhaustive);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::NotifyIdle(double idleTimeInSeconds)
+{
+    m_spIsolateImpl->NotifyIdle(idleTimeInSeconds);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::DrainMicrotasks(double timeBudgetInSeconds)
+{
+    m_spIsolateImpl->DrainMicrotasks(timeBudgetInSeconds);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::OnAccessSettingsChanged()
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+
+        Dispose(m_hAccessToken);
+        m_hAccessToken = CreatePersistent(CreateObject());
+
+        // Host objects with type-specific templates reach cached members without interception,
+        // so their caches can't be validated lazily and must be cleared here.
+
+        if (!m_HostTypeTemplateMap.empty() && (m_pvV8ObjectCache != nullptr))
+        {
+            std::vector<void*> v8ObjectPtrs;
+            HostObjectHelpers::GetAllCachedV8Objects(m_pvV8ObjectCache, v8ObjectPtrs);
+            for (auto pvV8Object : v8ObjectPtrs)
+            {
+                ClearHostObjectCache(CreateLocal(::HandleFromPtr<v8::Object>(pvV8Object)));
+            }
+        }
+
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::CaptureResetBaseline()
+{
+    BEGIN_CONTEXT_SCOPE
+    FROM_MAYBE_TRY
+
+        auto hBaseline = CreateObject();
+
+        auto hNames = FROM_MAYBE(m_hContext->Global()->GetPropertyNames(m_hContext, v8::KeyCollectionMode::kOwnOnly, v8::ALL_PROPERTIES, v8::IndexFilter::kIncludeIndices, v8::KeyConversionMode::kConvertToString));
+        auto nameCount = hNames->Length();
+        for (std::uint32_t index = 0; index < nameCount; index++)
+        {
+            FROM_MAYBE(hBaseline->Set(m_hContext, FROM_MAYBE(hNames->Get(m_hContext, index)), GetTrue()));
+        }
+
+        Dispose(m_hResetBaseline);
+        m_hResetBaseline = CreatePersistent(hBaseline);
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The V8 runtime cannot perform the requested operation because a script exception is pending"), false /*executionStarted*/);
+
+    FROM_MAYBE_END
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::Reset()
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+    FROM_MAYBE_TRY
+
+        for (auto it = m_GlobalMembersStack.rbegin(); it != m_GlobalMembersStack.rend(); it++)
+        {
+            Dispose(it->second);
+        }
+
+        m_GlobalMembersStack.clear();
+
+        if (!m_hResetBaseline.IsEmpty())
+        {
+            auto hGlobal = m_hContext->Global();
+            auto hNames = FROM_MAYBE(hGlobal->GetPropertyNames(m_hContext, v8::KeyCollectionMode::kOwnOnly, v8::ALL_PROPERTIES, v8::IndexFilter::kIncludeIndices, v8::KeyConversionMode::kConvertToString));
+            auto nameCount = hNames->Length();
+            for (std::uint32_t index = 0; index < nameCount; index++)
+            {
+                auto hName = FROM_MAYBE(hNames->Get(m_hContext, index));
+                if (!FROM_MAYBE(m_hResetBaseline->HasOwnProperty(m_hContext, hName.As<v8::Name>())))
+                {
+                    // top-level var and function declarations are not configurable
+                    if (!FROM_MAYBE_DEFAULT(hGlobal->Delete(m_hContext, hName)))
+                    {
+                        FROM_MAYBE_DEFAULT(hGlobal->Set(m_hContext, hName, GetUndefined()));
+                    }
+                }
+            }
+        }
+
+        if (m_pvV8ObjectCache != nullptr)
+        {
+            std::vector<void*> v8ObjectPtrs;
+            HostObjectHelpers::GetAllCachedV8Objects(m_pvV8ObjectCache, v8ObjectPtrs);
+            for (auto pvV8Object : v8ObjectPtrs)
+            {
+                auto hObject = ::HandleFromPtr<v8::Object>(pvV8Object);
+
+                auto pHolder = GetHostObjectHolder(hObject);
+                if (pHolder != nullptr)
+                {
+                    // script objects that survive the reset must no longer reach the host object
+                    FROM_MAYBE_DEFAULT(hObject->DeletePrivate(m_hContext, GetHostObjectHolderKey()));
+                    delete pHolder;
+                }
+
+                ClearWeak(hObject);
+                Dispose(hObject);
+            }
+
+            HostObjectHelpers::Release(m_pvV8ObjectCache);
+            m_pvV8ObjectCache = HostObjectHelpers::CreateV8ObjectCache();
+        }
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The V8 runtime cannot perform the requested operation because a script exception is pending"), EXECUTION_STARTED);
+
+    FROM_MAYBE_END
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+
+    ContextDisposedNotification();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::Destroy()
+{
+    m_spIsolateImpl->CallWithLockNoWait([this] (V8IsolateImpl* /*pIsolateImpl*/)
+    {
+        delete this;
+    });
+}
+
+//-----------------------------------------------------------------------------
+
+V8Value V8ContextImpl::GetV8ObjectProperty(void* pvObject, const StdString& name)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+    FROM_MAYBE_TRY
+
+        return ExportValue(FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Get(m_hContext, FROM_MAYBE(CreateString(name)))));
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The V8 runtime cannot perform the requested operation because a script exception is pending"), EXECUTION_STARTED);
+
+    FROM_MAYBE_END
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::SetV8ObjectProperty(void* pvObject, const StdString& name, const V8Value& value)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+    FROM_MAYBE_TRY
+
+        ASSERT_EVAL(FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Set(m_hContext, FROM_MAYBE(CreateString(name)), ImportValue(value))));
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The V8 runtime cannot perform the requested operation because a script exception is pending"), EXECUTION_STARTED);
+
+    FROM_MAYBE_END
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8ContextImpl::DeleteV8ObjectProperty(void* pvObject, const StdString& name)
+{
+    BEGIN_CONTEXT_SCOPE
+    FROM_MAYBE_TRY
+
+        return FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Delete(m_hContext, FROM_MAYBE(CreateString(name))));
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The V8 runtime cannot perform the requested operation because a script exception is pending"), false /*executionStarted*/);
+
+    FROM_MAYBE_END
+    END_CONTEXT_SCOPE
 }
 
 //-----------------------------------------------------------------------------
 
-void V8ContextImpl::OnAccessSettingsChanged()
+void V8ContextImpl::GetV8ObjectPropertyNames(void* pvObject, std::vector<StdString>& names)
 {
     BEGIN_CONTEXT_SCOPE
-    BEGIN_EXECUTION_SCOPE
 
-        Dispose(m_hAccessToken);
-        m_hAccessToken = CreatePersistent(CreateObject());
+        GetV8ObjectPropertyNames(::HandleFromPtr<v8::Object>(pvObject), names, v8::ONLY_ENUMERABLE);
 
-    END_EXECUTION_SCOPE
     END_CONTEXT_SCOPE
 }
 
 //-----------------------------------------------------------------------------
 
-void V8ContextImpl::Destroy()
+void V8ContextImpl::GetV8ObjectProperties(void* pvObject, const std::vector<StdString>& names, std::vector<V8Value>& values)
 {
-    m_spIsolateImpl->CallWithLockNoWait([this] (V8IsolateImpl* /*pIsolateImpl*/)
-    {
-        delete this;
-    });
-}
+    // all properties are retrieved within a single isolate, context, and execution scope
 
-//-----------------------------------------------------------------------------
+    values.clear();
+    values.reserve(names.size());
 
-V8Value V8ContextImpl::GetV8ObjectProperty(void* pvObject, const StdString& name)
-{
     BEGIN_CONTEXT_SCOPE
     BEGIN_EXECUTION_SCOPE
     FROM_MAYBE_TRY
 
-        return ExportValue(FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Get(m_hContext, FROM_MAYBE(CreateString(name)))));
+        auto hObject = ::HandleFromPtr<v8::Object>(pvObject);
+        for (const auto& name : names)
+        {
+            values.push_back(ExportValue(FROM_MAYBE(hObject->Get(m_hContext, FROM_MAYBE(CreateString(name))))));
+        }
 
     FROM_MAYBE_CATCH
 
@@ -676,13 +1472,22 @@ V8Value V8ContextImpl::GetV8ObjectProperty(void* pvObject, const StdString& name
 
 //-----------------------------------------------------------------------------
 
-void V8ContextImpl::SetV8ObjectProperty(void* pvObject, const StdString& name, const V8Value& value)
+void V8ContextImpl::SetV8ObjectProperties(void* pvObject, const std::vector<StdString>& names, const std::vector<V8Value>& values)
 {
+    // all properties are assigned within a single isolate, context, and execution scope
+
+    _ASSERTE(names.size() == values.size());
+    auto count = std::min(names.size(), values.size());
+
     BEGIN_CONTEXT_SCOPE
     BEGIN_EXECUTION_SCOPE
     FROM_MAYBE_TRY
 
-        ASSERT_EVAL(FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Set(m_hContext, FROM_MAYBE(CreateString(name)), ImportValue(value))));
+        auto hObject = ::HandleFromPtr<v8::Object>(pvObject);
+        for (size_t index = 0; index < count; index++)
+        {
+            ASSERT_EVAL(FROM_MAYBE(hObject->Set(m_hContext, FROM_MAYBE(CreateString(names[index])), ImportValue(values[index]))));
+        }
 
     FROM_MAYBE_CATCH
 
@@ -695,29 +1500,35 @@ void V8ContextImpl::SetV8ObjectProperty(void* pvObject, const StdString& name, c
 
 //-----------------------------------------------------------------------------
 
-bool V8ContextImpl::DeleteV8ObjectProperty(void* pvObject, const StdString& name)
+void V8ContextImpl::ExportV8ObjectGraph(void* pvObject, int maxDepth, size_t maxSize, std::vector<std::uint8_t>& graph)
 {
+    // The entire graph is walked within a single isolate, context, and execution scope and
+    // serialized into a flat buffer that the host decodes in one pass. See V8ObjectGraph.cs.
+
+    graph.clear();
+
     BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
     FROM_MAYBE_TRY
 
-        return FROM_MAYBE(::HandleFromPtr<v8::Object>(pvObject)->Delete(m_hContext, FROM_MAYBE(CreateString(name))));
+        try
+        {
+            std::vector<v8::Local<v8::Object>> path;
+            ExportGraphValue(::HandleFromPtr<v8::Object>(pvObject), maxDepth, maxSize, path, graph);
+        }
+        catch (const ObjectGraphFailure& failure)
+        {
+            graph.clear();
+            throw V8Exception(V8Exception::Type::General, m_Name, StdString(failure.GetDescription()), EXECUTION_STARTED);
+        }
 
     FROM_MAYBE_CATCH
 
-        throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The V8 runtime cannot perform the requested operation because a script exception is pending"), false /*executionStarted*/);
+        graph.clear();
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The V8 runtime cannot perform the requested operation because a script exception is pending"), EXECUTION_STARTED);
 
     FROM_MAYBE_END
-    END_CONTEXT_SCOPE
-}
-
-//-----------------------------------------------------------------------------
-
-void V8ContextImpl::GetV8ObjectPropertyNames(void* pvObject, std::vector<StdString>& names)
-{
-    BEGIN_CONTEXT_SCOPE
-
-        GetV8ObjectPropertyNames(::HandleFromPtr<v8::Object>(pvObject), names, v8::ONLY_ENUMERABLE);
-
+    END_EXECUTION_SCOPE
     END_CONTEXT_SCOPE
 }
 
@@ -894,6 +1705,16 @@ void V8ContextImpl::GetV8ObjectArrayBufferOrViewInfo(void* pvObject, V8Value& ar
             return;
         }
 
+        if (hObject->IsSharedArrayBuffer())
+        {
+            auto hSharedArrayBuffer = v8::Local<v8::SharedArrayBuffer>::Cast(hObject);
+            arrayBuffer = ExportValue(hObject);
+            offset = 0;
+            size = hSharedArrayBuffer->ByteLength();
+            length = size;
+            return;
+        }
+
         if (hObject->IsDataView())
         {
             auto hDataView = v8::Local<v8::DataView>::Cast(hObject);
@@ -934,6 +1755,13 @@ void V8ContextImpl::InvokeWithV8ObjectArrayBufferOrViewData(void* pvObject, V8Ob
             return;
         }
 
+        if (hObject->IsSharedArrayBuffer())
+        {
+            auto hSharedArrayBuffer = v8::Local<v8::SharedArrayBuffer>::Cast(hObject);
+            (*pCallback)(hSharedArrayBuffer->GetContents().Data(), pvArg);
+            return;
+        }
+
         if (hObject->IsDataView())
         {
             auto hDataView = v8::Local<v8::DataView>::Cast(hObject);
@@ -956,6 +1784,33 @@ void V8ContextImpl::InvokeWithV8ObjectArrayBufferOrViewData(void* pvObject, V8Ob
 
 //-----------------------------------------------------------------------------
 
+void V8ContextImpl::SettleV8Promise(void* pvResolver, bool resolve, const V8Value& value)
+{
+    BEGIN_CONTEXT_SCOPE
+    BEGIN_EXECUTION_SCOPE
+    FROM_MAYBE_TRY
+
+        auto hResolver = ::HandleFromPtr<v8::Promise::Resolver>(pvResolver);
+        if (resolve)
+        {
+            ASSERT_EVAL(FROM_MAYBE(hResolver->Resolve(m_hContext, ImportValue(value))));
+        }
+        else
+        {
+            ASSERT_EVAL(FROM_MAYBE(hResolver->Reject(m_hContext, ImportValue(value))));
+        }
+
+    FROM_MAYBE_CATCH
+
+        throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The V8 runtime cannot perform the requested operation because a script exception is pending"), EXECUTION_STARTED);
+
+    FROM_MAYBE_END
+    END_EXECUTION_SCOPE
+    END_CONTEXT_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
 bool V8ContextImpl::IsHostObject(v8::Local<v8::Object> hObject)
 {
     BEGIN_CONTEXT_SCOPE
@@ -1000,6 +1855,14 @@ void V8ContextImpl::Teardown()
         Dispose(it->second);
     }
 
+    Dispose(m_hResetBaseline);
+
+    for (auto& pair : m_HostTypeTemplateMap)
+    {
+        Dispose(pair.second);
+    }
+
+    m_HostTypeTemplateMap.clear();
     Dispose(m_hHostIteratorTemplate);
     Dispose(m_hHostDelegateTemplate);
     Dispose(m_hHostInvocableTemplate);
@@ -1054,6 +1917,74 @@ SharedPtr<V8WeakContextBinding> V8ContextImpl::GetWeakBinding()
 
 //-----------------------------------------------------------------------------
 
+Persistent<v8::FunctionTemplate> V8ContextImpl::GetHostObjectTemplate(void* pvObject)
+{
+    // Host objects whose members are fixed by their type get a type-specific template. Its named
+    // property interceptor is non-masking, so reads of cached members (see GetHostObjectProperty)
+    // are own accessor loads that bypass the interceptor and the host, and that V8's inline caches
+    // can specialize per type. Other host objects share the general host object template.
+
+    auto pvKey = HostObjectHelpers::GetTemplateKey(pvObject);
+    if (pvKey == nullptr)
+    {
+        return m_hHostObjectTemplate;
+    }
+
+    auto it = m_HostTypeTemplateMap.find(pvKey);
+    if (it != m_HostTypeTemplateMap.end())
+    {
+        return it->second;
+    }
+
+    if (m_HostTypeTemplateMap.size() >= s_MaxHostTypeTemplateCount)
+    {
+        return m_hHostObjectTemplate;
+    }
+
+    auto hContextImpl = CreateExternal(this);
+
+    auto hTemplate = CreateFunctionTemplate();
+    hTemplate->SetClassName(FROM_MAYBE(CreateString(StdString(L"HostObject"))));
+    hTemplate->SetCallHandler(HostObjectConstructorCallHandler, hContextImpl);
+    hTemplate->Inherit(m_hHostObjectTemplate);
+    hTemplate->InstanceTemplate()->SetHandler(v8::NamedPropertyHandlerConfiguration(GetHostObjectProperty, SetHostObjectProperty, QueryHostObjectProperty, DeleteHostObjectProperty, GetHostObjectPropertyNames, hContextImpl, v8::PropertyHandlerFlags::kNonMasking));
+    hTemplate->InstanceTemplate()->SetHandler(v8::IndexedPropertyHandlerConfiguration(GetHostObjectProperty, SetHostObjectProperty, QueryHostObjectProperty, DeleteHostObjectProperty, GetHostObjectPropertyIndices, hContextImpl));
+
+    auto hPersistentTemplate = CreatePersistent(hTemplate);
+    m_HostTypeTemplateMap.emplace(pvKey, hPersistentTemplate);
+    ++s_HostTypeTemplateCount;
+    return hPersistentTemplate;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::ClearHostObjectCache(v8::Local<v8::Object> hObject)
+{
+    FROM_MAYBE_TRY
+
+        BEGIN_PULSE_VALUE_SCOPE(&m_DisableHostObjectInterception, true)
+
+            auto hCache = ::ValueAsObject(FROM_MAYBE(hObject->GetPrivate(m_hContext, m_hCacheKey)));
+            if (!hCache.IsEmpty())
+            {
+                auto hNames = FROM_MAYBE(hCache->GetOwnPropertyNames(m_hContext));
+                for (auto index = hNames->Length(); index > 0; index--)
+                {
+                    ASSERT_EVAL(FROM_MAYBE(hObject->Delete(m_hContext, FROM_MAYBE(hNames->Get(m_hContext, index - 1)))));
+                }
+
+                ASSERT_EVAL(FROM_MAYBE(hObject->DeletePrivate(m_hContext, m_hCacheKey)));
+            }
+
+            ASSERT_EVAL(FROM_MAYBE(hObject->SetPrivate(m_hContext, m_hAccessTokenKey, m_hAccessToken)));
+
+        END_PULSE_VALUE_SCOPE
+
+    FROM_MAYBE_CATCH_CONSUME
+}
+
+//-----------------------------------------------------------------------------
+
 HostObjectHolder* V8ContextImpl::GetHostObjectHolder(v8::Local<v8::Object> hObject)
 {
     if (!hObject.IsEmpty())
@@ -1190,6 +2121,124 @@ void V8ContextImpl::GetV8ObjectPropertyIndices(v8::Local<v8::Object> hObject, st
 
 //-----------------------------------------------------------------------------
 
+void V8ContextImpl::ExportGraphValue(v8::Local<v8::Value> hValue, int maxDepth, size_t maxSize, std::vector<v8::Local<v8::Object>>& path, std::vector<std::uint8_t>& graph)
+{
+    if (hValue->IsUndefined())
+    {
+        WriteGraphTag(graph, maxSize, ObjectGraphTag::Undefined);
+        return;
+    }
+
+    if (hValue->IsNull())
+    {
+        WriteGraphTag(graph, maxSize, ObjectGraphTag::Null);
+        return;
+    }
+
+    if (hValue->IsBoolean())
+    {
+        WriteGraphTag(graph, maxSize, hValue->IsTrue() ? ObjectGraphTag::True : ObjectGraphTag::False);
+        return;
+    }
+
+    if (hValue->IsInt32())
+    {
+        WriteGraphValue(graph, maxSize, ObjectGraphTag::Int32, hValue.As<v8::Int32>()->Value());
+        return;
+    }
+
+    if (hValue->IsNumber())
+    {
+        WriteGraphValue(graph, maxSize, ObjectGraphTag::Number, hValue.As<v8::Number>()->Value());
+        return;
+    }
+
+    if (hValue->IsString())
+    {
+        WriteGraphTag(graph, maxSize, ObjectGraphTag::String);
+        ExportGraphString(hValue.As<v8::String>(), maxSize, graph);
+        return;
+    }
+
+    // only plain data objects and arrays are exported; functions, host objects, and objects with
+    // internal state are rejected rather than silently flattened
+
+    auto hObject = ValueAsObject(hValue);
+    if (hObject.IsEmpty() || hValue->IsFunction() || IsHostObject(hObject) || hValue->IsDate() || hValue->IsRegExp() || hValue->IsPromise() || hValue->IsProxy() || hValue->IsMap() || hValue->IsSet() || hValue->IsWeakMap() || hValue->IsWeakSet() || hValue->IsArrayBuffer() || hValue->IsArrayBufferView() || hValue->IsSharedArrayBuffer())
+    {
+        throw ObjectGraphFailure(L"The object graph contains a value that cannot be exported");
+    }
+
+    for (const auto& hPathObject : path)
+    {
+        if (hPathObject == hObject)
+        {
+            throw ObjectGraphFailure(L"The object graph contains a cycle");
+        }
+    }
+
+    if (static_cast<int>(path.size()) >= maxDepth)
+    {
+        throw ObjectGraphFailure(L"The object graph exceeds the maximum export depth");
+    }
+
+    path.push_back(hObject);
+
+    FROM_MAYBE_TRY
+
+        if (hValue->IsArray())
+        {
+            auto hArray = hValue.As<v8::Array>();
+            auto length = static_cast<std::int32_t>(hArray->Length());
+            WriteGraphValue(graph, maxSize, ObjectGraphTag::Array, length);
+
+            for (std::int32_t index = 0; index < length; index++)
+            {
+                ExportGraphValue(FROM_MAYBE(hArray->Get(m_hContext, static_cast<std::uint32_t>(index))), maxDepth, maxSize, path, graph);
+            }
+        }
+        else
+        {
+            auto hNames = FROM_MAYBE(hObject->GetPropertyNames(m_hContext, v8::KeyCollectionMode::kOwnOnly, static_cast<v8::PropertyFilter>(v8::ONLY_ENUMERABLE | v8::SKIP_SYMBOLS), v8::IndexFilter::kIncludeIndices, v8::KeyConversionMode::kConvertToString));
+            auto count = static_cast<std::int32_t>(hNames->Length());
+            WriteGraphValue(graph, maxSize, ObjectGraphTag::Object, count);
+
+            for (std::int32_t index = 0; index < count; index++)
+            {
+                auto hName = FROM_MAYBE(hNames->Get(m_hContext, static_cast<std::uint32_t>(index)));
+                ExportGraphString(hName.As<v8::String>(), maxSize, graph);
+                ExportGraphValue(FROM_MAYBE(hObject->Get(m_hContext, hName)), maxDepth, maxSize, path, graph);
+            }
+        }
+
+    FROM_MAYBE_CATCH
+
+        // let the caller report the pending script exception
+        throw;
+
+    FROM_MAYBE_END
+
+    path.pop_back();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::ExportGraphString(v8::Local<v8::String> hString, size_t maxSize, std::vector<std::uint8_t>& graph)
+{
+    // strings are written as a character count followed by UTF-16 code units
+
+    auto length = static_cast<std::int32_t>(hString->Length());
+    WriteGraphBytes(graph, maxSize, &length, sizeof length);
+
+    if (length > 0)
+    {
+        auto offset = ExtendGraph(graph, maxSize, length * sizeof(wchar_t));
+        WriteString(hString, reinterpret_cast<wchar_t*>(&graph[offset]), length);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void V8ContextImpl::GetGlobalProperty(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Value>& info)
 {
     auto hName = ::ValueAsString(hKey);
@@ -1720,24 +2769,8 @@ void V8ContextImpl::GetHostObjectProperty(v8::Local<v8::Name> hKey, const v8::Pr
                     auto hAccessToken = FROM_MAYBE(hHolder->GetPrivate(pContextImpl->m_hContext, pContextImpl->m_hAccessTokenKey));
                     if (pContextImpl->m_hAccessToken != hAccessToken)
                     {
-                        BEGIN_PULSE_VALUE_SCOPE(&pContextImpl->m_DisableHostObjectInterception, true)
-
-                            auto hCache = ::ValueAsObject(FROM_MAYBE(hHolder->GetPrivate(pContextImpl->m_hContext, pContextImpl->m_hCacheKey)));
-                            if (!hCache.IsEmpty())
-                            {
-                                auto hNames = FROM_MAYBE(hCache->GetOwnPropertyNames(pContextImpl->m_hContext));
-                                for (auto index = hNames->Length(); index > 0; index--)
-                                {
-                                    ASSERT_EVAL(FROM_MAYBE(hHolder->Delete(pContextImpl->m_hContext, FROM_MAYBE(hNames->Get(pContextImpl->m_hContext, index - 1)))));
-                                }
-
-                                ASSERT_EVAL(FROM_MAYBE(hHolder->DeletePrivate(pContextImpl->m_hContext, pContextImpl->m_hCacheKey)));
-                            }
-
-                            ASSERT_EVAL(FROM_MAYBE(hHolder->SetPrivate(pContextImpl->m_hContext, pContextImpl->m_hAccessTokenKey, pContextImpl->m_hAccessToken)));
-                            cacheCleared = true;
-
-                        END_PULSE_VALUE_SCOPE
+                        pContextImpl->ClearHostObjectCache(hHolder);
+                        cacheCleared = true;
                     }
 
                     v8::Local<v8::Value> hResult;
@@ -1754,6 +2787,7 @@ void V8ContextImpl::GetHostObjectProperty(v8::Local<v8::Name> hKey, const v8::Pr
                     }
 
                     bool isCacheable;
+                    ++s_HostPropertyFetchCount;
                     hResult = pContextImpl->ImportValue(HostObjectHelpers::GetProperty(pvObject, pContextImpl->CreateStdString(hName), isCacheable));
                     if (isCacheable)
                     {
@@ -1766,8 +2800,12 @@ void V8ContextImpl::GetHostObjectProperty(v8::Local<v8::Name> hKey, const v8::Pr
                                 ASSERT_EVAL(FROM_MAYBE(hHolder->SetPrivate(pContextImpl->m_hContext, pContextImpl->m_hCacheKey, hCache)));
                             }
 
+                            // Cached members are accessors rather than data properties. Host objects
+                            // with non-masking interceptors don't see assignments to existing own
+                            // properties, so the accessor's setter forwards them to the host.
+
                             ASSERT_EVAL(FROM_MAYBE(hCache->Set(pContextImpl->m_hContext, hName, hResult)));
-                            ASSERT_EVAL(FROM_MAYBE(hHolder->DefineOwnProperty(pContextImpl->m_hContext, hName, hResult, v8::DontEnum)));
+                            ASSERT_EVAL(FROM_MAYBE(hHolder->SetAccessor(pContextImpl->m_hContext, hName, GetCachedHostObjectProperty, SetCachedHostObjectProperty, info.Data(), v8::DEFAULT, v8::DontEnum)));
 
                         END_PULSE_VALUE_SCOPE
                     }
@@ -1917,6 +2955,64 @@ void V8ContextImpl::GetHostObjectPropertyNames(const v8::PropertyCallbackInfo<v8
 
 //-----------------------------------------------------------------------------
 
+void V8ContextImpl::GetCachedHostObjectProperty(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Value>& info)
+{
+    FROM_MAYBE_TRY
+
+        auto pContextImpl = ::GetContextImplFromData(info);
+        if (CheckContextImplForHostObjectCallback(pContextImpl))
+        {
+            auto hHolder = info.Holder();
+
+            auto hAccessToken = FROM_MAYBE(hHolder->GetPrivate(pContextImpl->m_hContext, pContextImpl->m_hAccessTokenKey));
+            if (pContextImpl->m_hAccessToken != hAccessToken)
+            {
+                // the cache is stale; GetHostObjectProperty clears it (removing this accessor)
+                // and fetches the member from the host again
+                GetHostObjectProperty(hKey, info);
+                return;
+            }
+
+            auto hCache = ::ValueAsObject(FROM_MAYBE(hHolder->GetPrivate(pContextImpl->m_hContext, pContextImpl->m_hCacheKey)));
+            if (!hCache.IsEmpty())
+            {
+                CALLBACK_RETURN(FROM_MAYBE(hCache->Get(pContextImpl->m_hContext, hKey)));
+            }
+        }
+
+    FROM_MAYBE_CATCH_CONSUME
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ContextImpl::SetCachedHostObjectProperty(v8::Local<v8::Name> hKey, v8::Local<v8::Value> hValue, const v8::PropertyCallbackInfo<void>& info)
+{
+    auto hName = ::ValueAsString(hKey);
+    if (hName.IsEmpty())
+    {
+        return;
+    }
+
+    auto pContextImpl = ::GetContextImplFromData(info);
+    if (CheckContextImplForHostObjectCallback(pContextImpl))
+    {
+        auto pvObject = pContextImpl->GetHostObject(info.Holder());
+        if (pvObject != nullptr)
+        {
+            try
+            {
+                HostObjectHelpers::SetProperty(pvObject, pContextImpl->CreateStdString(hName), pContextImpl->ExportValue(hValue));
+            }
+            catch (const HostException& exception)
+            {
+                pContextImpl->ThrowScriptException(exception);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void V8ContextImpl::GetHostObjectProperty(std::uint32_t index, const v8::PropertyCallbackInfo<v8::Value>& info)
 {
     auto pContextImpl = ::GetContextImplFromData(info);
@@ -2147,10 +3243,11 @@ v8::Local<v8::Value> V8ContextImpl::ImportValue(const V8Value& value)
         }
 
         {
-            const StdString* pString;
-            if (value.AsString(pString))
+            const wchar_t* pValue;
+            int length;
+            if (value.AsString(pValue, length))
             {
-                return FROM_MAYBE(CreateString(*pString));
+                return FROM_MAYBE(CreateString(pValue, length));
             }
         }
 
@@ -2169,8 +3266,9 @@ v8::Local<v8::Value> V8ContextImpl::ImportValue(const V8Value& value)
                 auto invocability = HostObjectHelpers::GetInvocability(pHolder->GetObject());
                 if (invocability == HostObjectHelpers::V8Invocability::None)
                 {
+                    auto hTemplate = GetHostObjectTemplate(pHolder->GetObject());
                     BEGIN_PULSE_VALUE_SCOPE(&m_AllowHostObjectConstructorCall, true)
-                        hObject = FROM_MAYBE(m_hHostObjectTemplate->InstanceTemplate()->NewInstance(m_hContext));
+                        hObject = FROM_MAYBE(hTemplate->InstanceTemplate()->NewInstance(m_hContext));
                     END_PULSE_VALUE_SCOPE
                 }
                 else if (invocability == HostObjectHelpers::V8Invocability::Delegate)
@@ -2200,6 +3298,12 @@ v8::Local<v8::Value> V8ContextImpl::ImportValue(const V8Value& value)
             V8Value::Subtype subtype;
             if (value.AsV8Object(pHolder, subtype))
             {
+                if (subtype == V8Value::Subtype::SharedArrayBuffer)
+                {
+                    // the holder may belong to another isolate; import its backing store
+                    return m_spIsolateImpl->ImportSharedArrayBuffer(static_cast<V8ObjectHolderImpl*>(pHolder)->GetSharedArrayBufferStore());
+                }
+
                 return CreateLocal(::HandleFromPtr<v8::Object>(pHolder->GetObject()));
             }
         }
@@ -2260,6 +3364,13 @@ V8Value V8ContextImpl::ExportValue(v8::Local<v8::Value> hValue)
 
         if (hValue->IsString())
         {
+            auto hString = hValue.As<v8::String>();
+            if (hString->Length() <= V8Value::MaxInlineStringLength)
+            {
+                wchar_t buffer[V8Value::MaxInlineStringLength];
+                return V8Value(buffer, WriteString(hString, buffer, V8Value::MaxInlineStringLength));
+            }
+
             return V8Value(new StdString(CreateStdString(hValue)));
         }
 
@@ -2278,8 +3389,16 @@ V8Value V8ContextImpl::ExportValue(v8::Local<v8::Value> hValue)
             }
 
             auto subtype = V8Value::Subtype::None;
+            SharedPtr<V8SharedArrayBufferStore> spSharedArrayBufferStore;
             if (hObject->IsArrayBuffer())
                 subtype = V8Value::Subtype::ArrayBuffer;
+            else if (hObject->IsSharedArrayBuffer())
+            {
+                // a SharedArrayBuffer whose memory can't be shared is exported as an ordinary object
+                spSharedArrayBufferStore = m_spIsolateImpl->GetSharedArrayBufferStore(v8::Local<v8::SharedArrayBuffer>::Cast(hObject));
+                if (!spSharedArrayBufferStore.IsEmpty())
+                    subtype = V8Value::Subtype::SharedArrayBuffer;
+            }
             else if (hObject->IsArrayBufferView())
                 if (hObject->IsDataView())
                     subtype = V8Value::Subtype::DataView;
@@ -2303,7 +3422,7 @@ V8Value V8ContextImpl::ExportValue(v8::Local<v8::Value> hValue)
                     else if (hObject->IsFloat64Array())
                         subtype = V8Value::Subtype::Float64Array;
 
-            return V8Value(new V8ObjectHolderImpl(GetWeakBinding(), ::PtrFromHandle(CreatePersistent(hObject))), subtype);
+            return V8Value(new V8ObjectHolderImpl(GetWeakBinding(), ::PtrFromHandle(CreatePersistent(hObject)), spSharedArrayBufferStore), subtype);
         }
 
     FROM_MAYBE_CATCH_CONSUME
@@ -22,6 +22,9 @@ public:
     explicit V8ContextImpl(V8IsolateImpl* pIsolateImpl);
     V8ContextImpl(V8IsolateImpl* pIsolateImpl, const StdString& name, const Options& options);
     static size_t GetInstanceCount();
+    static std::uint64_t GetHostTypeTemplateCount();
+    static std::uint64_t GetHostPropertyFetchCount();
+    static const intptr_t* GetExternalReferences();
 
     const StdString& GetName() const { return m_Name; }
     const Persistent<v8::Context>& GetContext() const { return m_hContext; }
@@ -30,6 +33,8 @@ public:
     virtual void SetMaxIsolateHeapSize(size_t value) override;
     virtual double GetIsolateHeapSizeSampleInterval() override;
     virtual void SetIsolateHeapSizeSampleInterval(double value) override;
+    virtual double GetIsolateTimeSliceInterval() override;
+    virtual void SetIsolateTimeSliceInterval(double value) override;
 
     virtual size_t GetMaxIsolateStackUsage() override;
     virtual void SetMaxIsolateStackUsage(size_t value) override;
@@ -45,13 +50,28 @@ public:
     virtual V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code) override;
     virtual V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code, V8CacheType cacheType, std::vector<std::uint8_t>& cacheBytes) override;
     virtual V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code, V8CacheType cacheType, const std::vector<std::uint8_t>& cacheBytes, bool& cacheAccepted) override;
+    virtual SharedPtr<V8ScriptCompilation> CompileAsync(const V8DocumentInfo& documentInfo, const StdString& code) override;
     virtual bool CanExecute(V8ScriptHolder* pHolder) override;
     virtual V8Value Execute(V8ScriptHolder* pHolder, bool evaluate) override;
+    virtual void CreateCacheBytes(V8ScriptHolder* pHolder, std::vector<std::uint8_t>& cacheBytes) override;
+
+    virtual V8Value ParseJson(const char* pJson, size_t size) override;
+    virtual void StringifyJson(const V8Value& value, std::string& json) override;
+
+    virtual V8Value CreatePromise(V8Value& resolver) override;
+    virtual void SettlePromiseAsync(const SharedPtr<V8ObjectHolder>& spResolverHolder, bool resolve, const V8Value& value) override;
+
+    virtual V8Value CreateExternalArrayBuffer(void* pvData, size_t size, ArrayBufferReleaseCallback&& releaseCallback) override;
 
     virtual void Interrupt() override;
     virtual void GetIsolateHeapInfo(V8IsolateHeapInfo& heapInfo) override;
+    virtual void GetIsolateHeapInfoSnapshot(V8IsolateHeapInfo& heapInfo) override;
     virtual void CollectGarbage(bool exhaustive) override;
+    virtual void NotifyIdle(double idleTimeInSeconds) override;
+    virtual void DrainMicrotasks(double timeBudgetInSeconds) override;
     virtual void OnAccessSettingsChanged() override;
+    virtual void CaptureResetBaseline() override;
+    virtual void Reset() override;
 
     virtual void Destroy() override;
 
@@ -59,6 +79,9 @@ public:
     void SetV8ObjectProperty(void* pvObject, const StdString& name, const V8Value& value);
     bool DeleteV8ObjectProperty(void* pvObject, const StdString& name);
     void GetV8ObjectPropertyNames(void* pvObject, std::vector<StdString>& names);
+    void GetV8ObjectProperties(void* pvObject, const std::vector<StdString>& names, std::vector<V8Value>& values);
+    void SetV8ObjectProperties(void* pvObject, const std::vector<StdString>& names, const std::vector<V8Value>& values);
+    void ExportV8ObjectGraph(void* pvObject, int maxDepth, size_t maxSize, std::vector<std::uint8_t>& graph);
 
     V8Value GetV8ObjectProperty(void* pvObject, int index);
     void SetV8ObjectProperty(void* pvObject, int index, const V8Value& value);
@@ -71,6 +94,8 @@ public:
     void GetV8ObjectArrayBufferOrViewInfo(void* pvObject, V8Value& arrayBuffer, size_t& offset, size_t& size, size_t& length);
     void InvokeWithV8ObjectArrayBufferOrViewData(void* pvObject, V8ObjectHelpers::ArrayBufferOrViewDataCallbackT* pCallback, void* pvArg);
 
+    void SettleV8Promise(void* pvResolver, bool resolve, const V8Value& value);
+
     bool IsHostObject(v8::Local<v8::Object> hObject);
 
 private:
@@ -152,6 +177,31 @@ private:
         return m_spIsolateImpl->CreateString(value);
     }
 
+    v8::MaybeLocal<v8::String> CreateString(const wchar_t* pValue, int length)
+    {
+        return m_spIsolateImpl->CreateString(pValue, length);
+    }
+
+    int WriteString(v8::Local<v8::String> hString, wchar_t* pBuffer, int length)
+    {
+        return m_spIsolateImpl->WriteString(hString, pBuffer, length);
+    }
+
+    v8::MaybeLocal<v8::String> CreateStringFromUtf8(const char* pValue, int length)
+    {
+        return m_spIsolateImpl->CreateStringFromUtf8(pValue, length);
+    }
+
+    int GetUtf8Length(v8::Local<v8::String> hString)
+    {
+        return m_spIsolateImpl->GetUtf8Length(hString);
+    }
+
+    int WriteUtf8(v8::Local<v8::String> hString, char* pBuffer, int size)
+    {
+        return m_spIsolateImpl->WriteUtf8(hString, pBuffer, size);
+    }
+
     StdString CreateStdString(v8::Local<v8::Value> hValue)
     {
         return m_spIsolateImpl->CreateStdString(hValue);
@@ -192,6 +242,11 @@ private:
         return m_spIsolateImpl->CreateUnboundScript(pSource, options);
     }
 
+    v8::ScriptCompiler::ScriptStreamingTask* StartStreamingScript(v8::ScriptCompiler::StreamedSource* pSource)
+    {
+        return m_spIsolateImpl->StartStreamingScript(pSource);
+    }
+
     template <typename T>
     v8::Local<T> CreateLocal(v8::Local<T> hTarget)
     {
@@ -291,6 +346,9 @@ private:
 
     SharedPtr<V8WeakContextBinding> GetWeakBinding();
 
+    Persistent<v8::FunctionTemplate> GetHostObjectTemplate(void* pvObject);
+    void ClearHostObjectCache(v8::Local<v8::Object> hObject);
+
     HostObjectHolder* GetHostObjectHolder(v8::Local<v8::Object> hObject);
     bool SetHostObjectHolder(v8::Local<v8::Object> hObject, HostObjectHolder* pHolder);
     void* GetHostObject(v8::Local<v8::Object> hObject);
@@ -300,6 +358,8 @@ private:
 
     void GetV8ObjectPropertyNames(v8::Local<v8::Object> hObject, std::vector<StdString>& names, v8::PropertyFilter filter);
     void GetV8ObjectPropertyIndices(v8::Local<v8::Object> hObject, std::vector<int>& indices, v8::PropertyFilter filter);
+    void ExportGraphValue(v8::Local<v8::Value> hValue, int maxDepth, size_t maxSize, std::vector<v8::Local<v8::Object>>& path, std::vector<std::uint8_t>& graph);
+    void ExportGraphString(v8::Local<v8::String> hString, size_t maxSize, std::vector<std::uint8_t>& graph);
 
     static void GetGlobalProperty(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Value>& info);
     static void SetGlobalProperty(v8::Local<v8::Name> hKey, v8::Local<v8::Value> hValue, const v8::PropertyCallbackInfo<v8::Value>& info);
@@ -324,6 +384,8 @@ private:
     static void QueryHostObjectProperty(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Integer>& info);
     static void DeleteHostObjectProperty(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Boolean>& info);
     static void GetHostObjectPropertyNames(const v8::PropertyCallbackInfo<v8::Array>& info);
+    static void GetCachedHostObjectProperty(v8::Local<v8::Name> hKey, const v8::PropertyCallbackInfo<v8::Value>& info);
+    static void SetCachedHostObjectProperty(v8::Local<v8::Name> hKey, v8::Local<v8::Value> hValue, const v8::PropertyCallbackInfo<void>& info);
 
     static void GetHostObjectProperty(std::uint32_t index, const v8::PropertyCallbackInfo<v8::Value>& info);
     static void SetHostObjectProperty(std::uint32_t index, v8::Local<v8::Value> hValue, const v8::PropertyCallbackInfo<v8::Value>& info);
@@ -338,6 +400,11 @@ private:
     V8Value ExportValue(v8::Local<v8::Value> hValue);
     void ImportValues(const std::vector<V8Value>& values, std::vector<v8::Local<v8::Value>>& importedValues);
 
+    V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code, const SharedPtr<V8CodeCacheStore>& spCodeCacheStore);
+    V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code, v8::ScriptCompiler::StreamedSource* pSource);
+    V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code, V8SharedScriptCacheImpl& sharedScriptCache);
+    v8::MaybeLocal<v8::UnboundScript> GetSharedScript(const V8DocumentInfo& documentInfo, const StdString& code, const SharedPtr<V8SharedScript>& spSharedScript);
+    v8::MaybeLocal<v8::UnboundScript> GetUnboundScript(V8ScriptHolder* pHolder);
     v8::ScriptOrigin CreateScriptOrigin(const V8DocumentInfo& documentInfo);
     void Verify(const V8IsolateImpl::ExecutionScope& isolateExecutionScope, const v8::TryCatch& tryCatch);
     void VerifyNotOutOfMemory();
@@ -362,6 +429,8 @@ private:
     Persistent<v8::FunctionTemplate> m_hHostInvocableTemplate;
     Persistent<v8::FunctionTemplate> m_hHostDelegateTemplate;
     Persistent<v8::FunctionTemplate> m_hHostIteratorTemplate;
+    std::unordered_map<void*, Persistent<v8::FunctionTemplate>> m_HostTypeTemplateMap;
+    Persistent<v8::Object> m_hResetBaseline;
     Persistent<v8::Value> m_hTerminationException;
     SharedPtr<V8WeakContextBinding> m_spWeakBinding;
     void* m_pvV8ObjectCache;
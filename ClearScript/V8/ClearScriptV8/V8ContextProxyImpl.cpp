@@ -71,6 +71,20 @@ namespace V8 {
 
     //-------------------------------------------------------------------------
 
+    TimeSpan V8ContextProxyImpl::RuntimeTimeSliceInterval::get()
+    {
+        return TimeSpan::FromMilliseconds(GetContext()->GetIsolateTimeSliceInterval());
+    }
+
+    //-------------------------------------------------------------------------
+
+    void V8ContextProxyImpl::RuntimeTimeSliceInterval::set(TimeSpan value)
+    {
+        GetContext()->SetIsolateTimeSliceInterval(value.TotalMilliseconds);
+    }
+
+    //-------------------------------------------------------------------------
+
     UIntPtr V8ContextProxyImpl::MaxRuntimeStackUsage::get()
     {
         return (UIntPtr)GetContext()->GetMaxIsolateStackUsage();
@@ -171,9 +185,6 @@ namespace V8 {
 
     V8Script^ V8ContextProxyImpl::Compile(DocumentInfo documentInfo, String^ gcCode, V8CacheKind cacheKind, [Out] array<Byte>^% gcCacheBytes)
     {
-        #pragma warning(push)
-        #pragma warning(disable:4947) /* 'Microsoft::ClearScript::V8::V8CacheKind::Parser': marked as obsolete */
-
         if (cacheKind == V8CacheKind::None)
         {
             gcCacheBytes = nullptr;
@@ -183,7 +194,7 @@ namespace V8 {
         try
         {
             std::vector<std::uint8_t> cacheBytes;
-            auto cacheType = (cacheKind == V8CacheKind::Parser) ? V8CacheType::Parser : V8CacheType::Code;
+            auto cacheType = V8IsolateProxyImpl::GetCacheType(cacheKind);
             auto gcScript = gcnew V8ScriptImpl(documentInfo, GetContext()->Compile(V8DocumentInfo(documentInfo), StdString(gcCode), cacheType, cacheBytes));
 
             auto length = static_cast<int>(cacheBytes.size());
@@ -203,17 +214,12 @@ namespace V8 {
         {
             exception.ThrowScriptEngineException();
         }
-
-        #pragma warning(pop)
     }
 
     //-------------------------------------------------------------------------
 
     V8Script^ V8ContextProxyImpl::Compile(DocumentInfo documentInfo, String^ gcCode, V8CacheKind cacheKind, array<Byte>^ gcCacheBytes, [Out] Boolean% cacheAccepted)
     {
-        #pragma warning(push)
-        #pragma warning(disable:4947) /* 'Microsoft::ClearScript::V8::V8CacheKind::Parser': marked as obsolete */
-
         if ((cacheKind == V8CacheKind::None) || (gcCacheBytes == nullptr) || (gcCacheBytes->Length < 1))
         {
             cacheAccepted = false;
@@ -227,7 +233,7 @@ namespace V8 {
             Marshal::Copy(gcCacheBytes, 0, (IntPtr)&cacheBytes[0], length);
 
             bool tempCacheAccepted;
-            auto cacheType = (cacheKind == V8CacheKind::Parser) ? V8CacheType::Parser : V8CacheType::Code;
+            auto cacheType = V8IsolateProxyImpl::GetCacheType(cacheKind);
             auto gcScript = gcnew V8ScriptImpl(documentInfo, GetContext()->Compile(V8DocumentInfo(documentInfo), StdString(gcCode), cacheType, cacheBytes, tempCacheAccepted));
 
             cacheAccepted = tempCacheAccepted;
@@ -237,8 +243,20 @@ namespace V8 {
         {
             exception.ThrowScriptEngineException();
         }
+    }
+
+    //-------------------------------------------------------------------------
 
-        #pragma warning(pop)
+    Task<V8Script^>^ V8ContextProxyImpl::CompileAsync(DocumentInfo documentInfo, String^ gcCode)
+    {
+        try
+        {
+            return V8ScriptImpl::FromCompilation(documentInfo, GetContext()->CompileAsync(V8DocumentInfo(documentInfo), StdString(gcCode)));
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -270,6 +288,157 @@ namespace V8 {
 
     //-------------------------------------------------------------------------
 
+    array<Byte>^ V8ContextProxyImpl::CreateCacheBytes(V8Script^ gcScript)
+    {
+        try
+        {
+            auto gcScriptImpl = dynamic_cast<V8ScriptImpl^>(gcScript);
+            if (gcScriptImpl == nullptr)
+            {
+                throw gcnew ArgumentException(L"Invalid compiled script", L"script");
+            }
+
+            auto spContext = GetContext();
+            auto spHolder = gcScriptImpl->GetHolder();
+            if (!spContext->CanExecute(spHolder))
+            {
+                throw gcnew ArgumentException(L"Invalid compiled script", L"script");
+            }
+
+            std::vector<std::uint8_t> cacheBytes;
+            spContext->CreateCacheBytes(spHolder, cacheBytes);
+
+            auto length = static_cast<int>(cacheBytes.size());
+            if (length < 1)
+            {
+                return nullptr;
+            }
+
+            auto gcCacheBytes = gcnew array<Byte>(length);
+            Marshal::Copy((IntPtr)&cacheBytes[0], gcCacheBytes, 0, length);
+            return gcCacheBytes;
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    Object^ V8ContextProxyImpl::ParseJson(array<Byte>^ gcJson)
+    {
+        try
+        {
+            // the UTF-8 text is passed to V8 in place, without copying or widening
+
+            auto length = gcJson->Length;
+            if (length < 1)
+            {
+                return ExportValue(GetContext()->ParseJson(nullptr, 0));
+            }
+
+            pin_ptr<Byte> pJson(&gcJson[0]);
+            return ExportValue(GetContext()->ParseJson(reinterpret_cast<const char*>(pJson), length));
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    array<Byte>^ V8ContextProxyImpl::StringifyJson(Object^ gcValue)
+    {
+        try
+        {
+            std::string json;
+            GetContext()->StringifyJson(ImportValue(gcValue), json);
+
+            auto length = static_cast<int>(json.size());
+            auto gcJson = gcnew array<Byte>(length);
+            if (length > 0)
+            {
+                Marshal::Copy((IntPtr)&json[0], gcJson, 0, length);
+            }
+
+            return gcJson;
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    Object^ V8ContextProxyImpl::CreatePromise([Out] Object^% gcResolver)
+    {
+        try
+        {
+            V8Value resolver(V8Value::Undefined);
+            auto gcPromise = ExportValue(GetContext()->CreatePromise(resolver));
+            gcResolver = ExportValue(resolver);
+            return gcPromise;
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void V8ContextProxyImpl::SettlePromise(Object^ gcResolver, Boolean resolve, Object^ gcValue)
+    {
+        auto gcResolverImpl = dynamic_cast<V8ObjectImpl^>(gcResolver);
+        if (gcResolverImpl == nullptr)
+        {
+            throw gcnew ArgumentException(L"Invalid promise resolver", L"resolver");
+        }
+
+        try
+        {
+            GetContext()->SettlePromiseAsync(gcResolverImpl->GetHolder(), resolve, ImportValue(gcValue));
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    Object^ V8ContextProxyImpl::CreateExternalArrayBuffer(IntPtr pData, UInt64 size, Action^ gcRelease)
+    {
+        if (size > SIZE_MAX)
+        {
+            throw gcnew ArgumentOutOfRangeException(L"size");
+        }
+
+        V8Context::ArrayBufferReleaseCallback releaseCallback;
+        if (gcRelease != nullptr)
+        {
+            auto pvRelease = V8ProxyHelpers::AddRefHostObject(gcRelease);
+            releaseCallback = [pvRelease] ()
+            {
+                InvokeArrayBufferRelease(pvRelease);
+            };
+        }
+
+        try
+        {
+            return ExportValue(GetContext()->CreateExternalArrayBuffer(pData.ToPointer(), static_cast<size_t>(size), std::move(releaseCallback)));
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void V8ContextProxyImpl::Interrupt()
     {
         GetContext()->Interrupt();
@@ -281,14 +450,16 @@ namespace V8 {
     {
         V8IsolateHeapInfo heapInfo;
         GetContext()->GetIsolateHeapInfo(heapInfo);
+        return V8IsolateProxyImpl::CreateHeapInfo(heapInfo);
+    }
+
+    //-------------------------------------------------------------------------
 
-        auto gcHeapInfo = gcnew V8RuntimeHeapInfo();
-        gcHeapInfo->TotalHeapSize = heapInfo.GetTotalHeapSize();
-        gcHeapInfo->TotalHeapSizeExecutable = heapInfo.GetTotalHeapSizeExecutable();
-        gcHeapInfo->TotalPhysicalSize = heapInfo.GetTotalPhysicalSize();
-        gcHeapInfo->UsedHeapSize = heapInfo.GetUsedHeapSize();
-        gcHeapInfo->HeapSizeLimit = heapInfo.GetHeapSizeLimit();
-        return gcHeapInfo;
+    V8RuntimeHeapInfo^ V8ContextProxyImpl::GetRuntimeHeapInfoSnapshot()
+    {
+        V8IsolateHeapInfo heapInfo;
+        GetContext()->GetIsolateHeapInfoSnapshot(heapInfo);
+        return V8IsolateProxyImpl::CreateHeapInfo(heapInfo);
     }
 
     //-------------------------------------------------------------------------
@@ -300,6 +471,27 @@ namespace V8 {
 
     //-------------------------------------------------------------------------
 
+    void V8ContextProxyImpl::NotifyIdle(TimeSpan idleTime)
+    {
+        GetContext()->NotifyIdle(idleTime.TotalSeconds);
+    }
+
+    //-------------------------------------------------------------------------
+
+    void V8ContextProxyImpl::DrainMicrotasks(TimeSpan timeBudget)
+    {
+        try
+        {
+            GetContext()->DrainMicrotasks(timeBudget.TotalSeconds);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void V8ContextProxyImpl::OnAccessSettingsChanged()
     {
         GetContext()->OnAccessSettingsChanged();
@@ -307,6 +499,34 @@ namespace V8 {
 
     //-------------------------------------------------------------------------
 
+    void V8ContextProxyImpl::CaptureResetBaseline()
+    {
+        try
+        {
+            GetContext()->CaptureResetBaseline();
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void V8ContextProxyImpl::Reset()
+    {
+        try
+        {
+            GetContext()->Reset();
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     V8ContextProxyImpl::~V8ContextProxyImpl()
     {
         SharedPtr<V8Context> spContext;
@@ -467,7 +687,8 @@ namespace V8 {
             auto gcValue = dynamic_cast<String^>(gcObject);
             if (gcValue != nullptr)
             {
-                return V8Value(new StdString(gcValue));
+                pin_ptr<const wchar_t> pValue(PtrToStringChars(gcValue));
+                return V8Value(pValue, gcValue->Length);
             }
         }
 
@@ -483,7 +704,14 @@ namespace V8 {
             auto gcValue = dynamic_cast<V8ObjectImpl^>(gcObject);
             if (gcValue != nullptr)
             {
-                return V8Value(gcValue->GetHolder()->Clone(), gcValue->GetSubtype());
+                auto subtype = gcValue->GetSubtype();
+                if (subtype == V8Value::Subtype::SharedArrayBuffer)
+                {
+                    // shared array buffers can be imported by any isolate
+                    return V8Value(V8ObjectHelpers::CreateSharedArrayBufferHolder(gcValue->GetHolder()), subtype);
+                }
+
+                return V8Value(gcValue->GetHolder()->Clone(), subtype);
             }
         }
 
@@ -542,10 +770,11 @@ namespace V8 {
         }
 
         {
-            const StdString* pString;
-            if (value.AsString(pString))
+            const wchar_t* pValue;
+            int length;
+            if (value.AsString(pValue, length))
             {
-                return pString->ToManagedString();
+                return gcnew String(pValue, 0, length);
             }
         }
 
@@ -595,6 +824,15 @@ namespace V8 {
 
     //-------------------------------------------------------------------------
 
+    void V8ContextProxyImpl::InvokeArrayBufferRelease(void* pvRelease)
+    {
+        auto gcRelease = safe_cast<Action^>(V8ProxyHelpers::GetHostObject(pvRelease));
+        V8ProxyHelpers::ReleaseHostObject(pvRelease);
+        gcRelease();
+    }
+
+    //-------------------------------------------------------------------------
+
     ENSURE_INTERNAL_CLASS(V8ContextProxyImpl)
 
 }}}
@@ -29,6 +29,12 @@ namespace V8 {
             virtual void set(TimeSpan value) override;
         }
 
+        property TimeSpan RuntimeTimeSliceInterval
+        {
+            virtual TimeSpan get() override;
+            virtual void set(TimeSpan value) override;
+        }
+
         property UIntPtr MaxRuntimeStackUsage
         {
             virtual UIntPtr get() override;
@@ -43,11 +49,23 @@ namespace V8 {
         virtual V8Script^ Compile(DocumentInfo documentInfo, String^ gcCode) override;
         virtual V8Script^ Compile(DocumentInfo documentInfo, String^ gcCode, V8CacheKind cacheKind, [Out] array<Byte>^% gcCacheBytes) override;
         virtual V8Script^ Compile(DocumentInfo documentInfo, String^ gcCode, V8CacheKind cacheKind, array<Byte>^ gcCacheBytes, [Out] Boolean% cacheAccepted) override;
+        virtual Task<V8Script^>^ CompileAsync(DocumentInfo documentInfo, String^ gcCode) override;
         virtual Object^ Execute(V8Script^ gcScript, Boolean evaluate) override;
+        virtual array<Byte>^ CreateCacheBytes(V8Script^ gcScript) override;
+        virtual Object^ ParseJson(array<Byte>^ gcJson) override;
+        virtual array<Byte>^ StringifyJson(Object^ gcValue) override;
+        virtual Object^ CreatePromise([Out] Object^% gcResolver) override;
+        virtual void SettlePromise(Object^ gcResolver, Boolean resolve, Object^ gcValue) override;
+        virtual Object^ CreateExternalArrayBuffer(IntPtr pData, UInt64 size, Action^ gcRelease) override;
         virtual void Interrupt() override;
         virtual V8RuntimeHeapInfo^ GetRuntimeHeapInfo() override;
+        virtual V8RuntimeHeapInfo^ GetRuntimeHeapInfoSnapshot() override;
         virtual void CollectGarbage(bool exhaustive) override;
+        virtual void NotifyIdle(TimeSpan idleTime) override;
+        virtual void DrainMicrotasks(TimeSpan timeBudget) override;
         virtual void OnAccessSettingsChanged() override;
+        virtual void CaptureResetBaseline() override;
+        virtual void Reset() override;
 
         ~V8ContextProxyImpl();
         !V8ContextProxyImpl();
@@ -58,6 +76,7 @@ namespace V8 {
     private:
 
         SharedPtr<V8Context> GetContext();
+        static void InvokeArrayBufferRelease(void* pvRelease);
 
         Object^ m_gcLock;
         SharedPtr<V8Context>* m_pspContext;
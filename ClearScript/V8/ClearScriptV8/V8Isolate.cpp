@@ -18,3 +18,24 @@ size_t V8Isolate::GetInstanceCount()
 {
     return V8IsolateImpl::GetInstanceCount();
 }
+
+//-----------------------------------------------------------------------------
+
+void V8Isolate::GetWorkerPoolStatistics(WorkerPoolStatistics& statistics)
+{
+    V8IsolateImpl::GetWorkerPoolStatistics(statistics);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8Isolate::GetIdleTaskCounts(std::uint64_t& postedCount, std::uint64_t& runCount)
+{
+    V8IsolateImpl::GetIdleTaskCounts(postedCount, runCount);
+}
+
+//-----------------------------------------------------------------------------
+
+V8SnapshotBlob* V8Isolate::CreateSnapshotBlob(const StdString& name, const StdString& warmUpCode)
+{
+    return V8IsolateImpl::CreateSnapshotBlob(name, warmUpCode);
+}
@@ -15,16 +15,32 @@ public:
     {
         bool EnableDebugging = false;
         bool EnableRemoteDebugging = false;
+        bool EnableThreadAffinity = false;
+        bool EnableExplicitMicrotasks = false;
         int DebugPort = 0;
+        SharedPtr<V8SnapshotBlob> SnapshotBlob;
+    };
+
+    struct WorkerPoolStatistics
+    {
+        size_t ThreadCount = 0;
+        size_t QueueDepth = 0;
+        std::uint64_t TaskCount = 0;
+        std::uint64_t StealCount = 0;
     };
 
     static V8Isolate* Create(const StdString& name, const V8IsolateConstraints* pConstraints, const Options& options);
     static size_t GetInstanceCount();
+    static void GetWorkerPoolStatistics(WorkerPoolStatistics& statistics);
+    static void GetIdleTaskCounts(std::uint64_t& postedCount, std::uint64_t& runCount);
+    static V8SnapshotBlob* CreateSnapshotBlob(const StdString& name, const StdString& warmUpCode);
 
     virtual size_t GetMaxHeapSize() = 0;
     virtual void SetMaxHeapSize(size_t value) = 0;
     virtual double GetHeapSizeSampleInterval() = 0;
     virtual void SetHeapSizeSampleInterval(double value) = 0;
+    virtual double GetTimeSliceInterval() = 0;
+    virtual void SetTimeSliceInterval(double value) = 0;
 
     virtual size_t GetMaxStackUsage() = 0;
     virtual void SetMaxStackUsage(size_t value) = 0;
@@ -33,8 +49,16 @@ public:
     virtual V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code) = 0;
     virtual V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code, V8CacheType cacheType, std::vector<std::uint8_t>& cacheBytes) = 0;
     virtual V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code, V8CacheType cacheType, const std::vector<std::uint8_t>& cacheBytes, bool& cacheAccepted) = 0;
+    virtual SharedPtr<V8ScriptCompilation> CompileAsync(const V8DocumentInfo& documentInfo, const StdString& code) = 0;
     virtual void GetHeapInfo(V8IsolateHeapInfo& heapInfo) = 0;
+    virtual void GetHeapInfoSnapshot(V8IsolateHeapInfo& heapInfo) = 0;
     virtual void CollectGarbage(bool exhaustive) = 0;
+    virtual void NotifyIdle(double idleTimeInSeconds) = 0;
+    virtual void DrainMicrotasks(double timeBudgetInSeconds) = 0;
+
+    virtual void SetCodeCacheDirectory(const StdString& directoryPath) = 0;
+    virtual void GetCodeCacheInfo(V8IsolateCodeCacheInfo& codeCacheInfo) = 0;
+    virtual void GetCallWithLockLatencyHistogram(std::vector<std::uint64_t>& histogram) = 0;
 
     virtual ~V8Isolate() {}
 };
@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8IsolateCodeCacheInfo
+//-----------------------------------------------------------------------------
+
+class V8IsolateCodeCacheInfo
+{
+public:
+
+    V8IsolateCodeCacheInfo()
+    {
+    }
+
+    void Set(size_t hitCount, size_t missCount, size_t acceptedCount, size_t rejectedCount, size_t storedCount)
+    {
+        m_HitCount = hitCount;
+        m_MissCount = missCount;
+        m_AcceptedCount = acceptedCount;
+        m_RejectedCount = rejectedCount;
+        m_StoredCount = storedCount;
+    }
+
+    size_t GetHitCount() const
+    {
+        return m_HitCount;
+    }
+
+    size_t GetMissCount() const
+    {
+        return m_MissCount;
+    }
+
+    size_t GetAcceptedCount() const
+    {
+        return m_AcceptedCount;
+    }
+
+    size_t GetRejectedCount() const
+    {
+        return m_RejectedCount;
+    }
+
+    size_t GetStoredCount() const
+    {
+        return m_StoredCount;
+    }
+
+private:
+
+    size_t m_HitCount = 0;
+    size_t m_MissCount = 0;
+    size_t m_AcceptedCount = 0;
+    size_t m_RejectedCount = 0;
+    size_t m_StoredCount = 0;
+};
@@ -0,0 +1,13 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Native.h"
+
+//-----------------------------------------------------------------------------
+// V8IsolateGroup implementation
+//-----------------------------------------------------------------------------
+
+V8IsolateGroup* V8IsolateGroup::Create(const StdString& name, const V8IsolateConstraints* pConstraints, size_t isolateCount, const V8DocumentInfo& documentInfo, const StdString& code)
+{
+    return new V8IsolateGroupImpl(name, pConstraints, isolateCount, documentInfo, code);
+}
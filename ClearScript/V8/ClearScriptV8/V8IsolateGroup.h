@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8IsolateGroup
+//-----------------------------------------------------------------------------
+
+class V8IsolateGroup: public SharedPtrTarget
+{
+public:
+
+    struct Statistics
+    {
+        size_t IsolateCount = 0;
+        std::uint64_t BatchCount = 0;
+        std::uint64_t RecordCount = 0;
+        std::uint64_t StealCount = 0;
+    };
+
+    static V8IsolateGroup* Create(const StdString& name, const V8IsolateConstraints* pConstraints, size_t isolateCount, const V8DocumentInfo& documentInfo, const StdString& code);
+
+    virtual size_t GetIsolateCount() = 0;
+    virtual void Invoke(const std::vector<V8Value>& records, size_t batchSize, std::vector<V8Value>& results) = 0;
+    virtual void GetStatistics(Statistics& statistics) = 0;
+
+    virtual ~V8IsolateGroup() {}
+};
@@ -0,0 +1,229 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Native.h"
+
+//-----------------------------------------------------------------------------
+// BatchCompletionScope
+//-----------------------------------------------------------------------------
+
+class BatchCompletionScope
+{
+    PROHIBIT_COPY(BatchCompletionScope)
+    PROHIBIT_HEAP(BatchCompletionScope)
+
+public:
+
+    BatchCompletionScope(SimpleMutex& mutex, std::condition_variable& completed, size_t& pendingCount):
+        m_Mutex(mutex),
+        m_Completed(completed),
+        m_PendingCount(pendingCount)
+    {
+    }
+
+    // the waiting thread owns the condition variable, so it's signaled under the mutex
+    ~BatchCompletionScope()
+    {
+        BEGIN_MUTEX_SCOPE(m_Mutex)
+            if (--m_PendingCount == 0)
+            {
+                m_Completed.notify_one();
+            }
+        END_MUTEX_SCOPE
+    }
+
+private:
+
+    SimpleMutex& m_Mutex;
+    std::condition_variable& m_Completed;
+    size_t& m_PendingCount;
+};
+
+//-----------------------------------------------------------------------------
+// V8IsolateGroupImpl implementation
+//-----------------------------------------------------------------------------
+
+V8IsolateGroupImpl::V8IsolateGroupImpl(const StdString& name, const V8IsolateConstraints* pConstraints, size_t isolateCount, const V8DocumentInfo& documentInfo, const StdString& code):
+    m_Name(name),
+    m_BatchCount(0),
+    m_RecordCount(0)
+{
+    isolateCount = std::max(isolateCount, static_cast<size_t>(1));
+    m_Members.reserve(isolateCount);
+
+    // The first isolate compiles the script and produces a code cache; the others consume it.
+    // If V8 declines to produce a cache, each isolate compiles the script from scratch.
+
+    std::vector<std::uint8_t> cacheBytes;
+    for (size_t index = 0; index < isolateCount; index++)
+    {
+        std::unique_ptr<Member> spMember(new Member);
+        spMember->spIsolate = V8Isolate::Create(name, pConstraints, V8Isolate::Options());
+        spMember->spContext = V8Context::Create(spMember->spIsolate, name, V8Context::Options());
+
+        SharedPtr<V8ScriptHolder> spScriptHolder;
+        if (index == 0)
+        {
+            spScriptHolder = spMember->spContext->Compile(documentInfo, code, V8CacheType::Code, cacheBytes);
+        }
+        else
+        {
+            bool cacheAccepted;
+            spScriptHolder = spMember->spContext->Compile(documentInfo, code, V8CacheType::Code, cacheBytes, cacheAccepted);
+        }
+
+        spMember->Function = spMember->spContext->Execute(spScriptHolder.GetRawPtr(), true /*evaluate*/);
+
+        V8ObjectHolder* pFunctionHolder;
+        V8Value::Subtype subtype;
+        if (!spMember->Function.AsV8Object(pFunctionHolder, subtype))
+        {
+            throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The script did not evaluate to a function"), false /*executionStarted*/);
+        }
+
+        m_Members.push_back(std::move(spMember));
+    }
+
+    m_spWorkerPool.reset(new V8WorkerPool(isolateCount));
+}
+
+//-----------------------------------------------------------------------------
+
+size_t V8IsolateGroupImpl::GetIsolateCount()
+{
+    return m_Members.size();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateGroupImpl::Invoke(const std::vector<V8Value>& records, size_t batchSize, std::vector<V8Value>& results)
+{
+    auto recordCount = records.size();
+    results.assign(recordCount, V8Value(V8Value::Undefined));
+
+    batchSize = std::max(batchSize, static_cast<size_t>(1));
+    auto batchCount = (recordCount + batchSize - 1) / batchSize;
+    if (batchCount < 1)
+    {
+        return;
+    }
+
+    SimpleMutex mutex;
+    std::condition_variable completed;
+    auto pendingCount = batchCount;
+    std::unique_ptr<V8Exception> spException;
+    std::atomic<bool> failed(false);
+
+    for (size_t batchIndex = 0; batchIndex < batchCount; batchIndex++)
+    {
+        auto start = batchIndex * batchSize;
+        auto count = std::min(batchSize, recordCount - start);
+
+        m_spWorkerPool->PostTask(V8WorkerPool::Priority::Normal, [this, &records, &results, &mutex, &completed, &pendingCount, &spException, &failed, start, count]
+        {
+            BatchCompletionScope completionScope(mutex, completed, pendingCount);
+
+            // each worker thread owns the isolate with the same index; a stolen batch runs there
+            size_t workerIndex = 0;
+            ASSERT_EVAL(m_spWorkerPool->TryGetCurrentWorkerIndex(workerIndex));
+            auto& member = *m_Members[workerIndex];
+
+            if (!failed)
+            {
+                try
+                {
+                    V8ObjectHolder* pFunctionHolder;
+                    V8Value::Subtype subtype;
+                    ASSERT_EVAL(member.Function.AsV8Object(pFunctionHolder, subtype));
+
+                    Batch batch { pFunctionHolder, &records[start], &results[start], count };
+                    member.spContext->CallWithLock(RunBatch, &batch);
+
+                    ++m_BatchCount;
+                    m_RecordCount += count;
+                }
+                catch (const V8Exception& exception)
+                {
+                    BEGIN_MUTEX_SCOPE(mutex)
+                        if (!spException)
+                        {
+                            spException.reset(new V8Exception(exception));
+                        }
+                    END_MUTEX_SCOPE
+
+                    failed = true;
+                }
+                catch (...)
+                {
+                    BEGIN_MUTEX_SCOPE(mutex)
+                        if (!spException)
+                        {
+                            spException.reset(new V8Exception(V8Exception::Type::General, m_Name, StdString(L"An unexpected error occurred while processing a batch"), true /*executionStarted*/));
+                        }
+                    END_MUTEX_SCOPE
+
+                    failed = true;
+                }
+            }
+        });
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex.GetImpl());
+        completed.wait(lock, [&pendingCount] { return pendingCount == 0; });
+    }
+
+    if (spException)
+    {
+        throw *spException;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateGroupImpl::GetStatistics(Statistics& statistics)
+{
+    size_t queueDepth;
+    std::uint64_t taskCount;
+    m_spWorkerPool->GetStatistics(queueDepth, taskCount, statistics.StealCount);
+
+    statistics.IsolateCount = m_Members.size();
+    statistics.BatchCount = m_BatchCount;
+    statistics.RecordCount = m_RecordCount;
+}
+
+//-----------------------------------------------------------------------------
+
+V8IsolateGroupImpl::~V8IsolateGroupImpl()
+{
+    // stop the workers before releasing the isolates they use
+    m_spWorkerPool.reset();
+    m_Members.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateGroupImpl::RunBatch(void* pvBatch)
+{
+    // The caller holds the isolate lock for the entire batch, so the scopes entered for each
+    // record nest without contention.
+
+    auto& batch = *static_cast<Batch*>(pvBatch);
+    std::vector<V8Value> args(1, V8Value(V8Value::Undefined));
+
+    for (size_t index = 0; index < batch.Count; index++)
+    {
+        args[0] = batch.pRecords[index];
+        auto result = V8ObjectHelpers::Invoke(batch.pFunctionHolder, args, false /*asConstructor*/);
+
+        // script objects are bound to the isolate that created them and aren't returned
+        V8ObjectHolder* pHolder;
+        V8Value::Subtype subtype;
+        if (result.AsV8Object(pHolder, subtype))
+        {
+            result = V8Value(V8Value::Undefined);
+        }
+
+        batch.pResults[index] = std::move(result);
+    }
+}
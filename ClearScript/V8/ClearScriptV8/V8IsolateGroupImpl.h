@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8IsolateGroupImpl
+//
+// A set of isolates that run the same script function over batches of records. Each isolate is
+// bound to one thread of a private work-stealing pool, so isolates never contend for locks; idle
+// threads steal pending batches from busy ones. The script is compiled once and then loaded into
+// the remaining isolates from its code cache.
+//-----------------------------------------------------------------------------
+
+class V8IsolateGroupImpl: public V8IsolateGroup
+{
+    PROHIBIT_COPY(V8IsolateGroupImpl)
+
+public:
+
+    V8IsolateGroupImpl(const StdString& name, const V8IsolateConstraints* pConstraints, size_t isolateCount, const V8DocumentInfo& documentInfo, const StdString& code);
+
+    virtual size_t GetIsolateCount() override;
+    virtual void Invoke(const std::vector<V8Value>& records, size_t batchSize, std::vector<V8Value>& results) override;
+    virtual void GetStatistics(Statistics& statistics) override;
+
+    ~V8IsolateGroupImpl();
+
+private:
+
+    struct Member
+    {
+        Member():
+            Function(V8Value::Undefined)
+        {
+        }
+
+        SharedPtr<V8Isolate> spIsolate;
+        SharedPtr<V8Context> spContext;
+        V8Value Function;
+    };
+
+    struct Batch
+    {
+        V8ObjectHolder* pFunctionHolder;
+        const V8Value* pRecords;
+        V8Value* pResults;
+        size_t Count;
+    };
+
+    static void RunBatch(void* pvBatch);
+
+    StdString m_Name;
+    std::vector<std::unique_ptr<Member>> m_Members;
+    std::unique_ptr<V8WorkerPool> m_spWorkerPool;
+    std::atomic<std::uint64_t> m_BatchCount;
+    std::atomic<std::uint64_t> m_RecordCount;
+};
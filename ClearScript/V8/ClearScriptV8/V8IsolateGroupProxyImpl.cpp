@@ -0,0 +1,149 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Managed.h"
+
+namespace Microsoft {
+namespace ClearScript {
+namespace V8 {
+
+    //-------------------------------------------------------------------------
+    // V8IsolateGroupProxyImpl implementation
+    //-------------------------------------------------------------------------
+
+    V8IsolateGroupProxyImpl::V8IsolateGroupProxyImpl(String^ gcName, V8RuntimeConstraints^ gcConstraints, Int32 isolateCount, DocumentInfo documentInfo, String^ gcCode):
+        m_gcLock(gcnew Object)
+    {
+        const V8IsolateConstraints* pConstraints = nullptr;
+
+        V8IsolateConstraints constraints;
+        if (gcConstraints != nullptr)
+        {
+            constraints.Set(V8IsolateProxyImpl::AdjustConstraint(gcConstraints->MaxNewSpaceSize), V8IsolateProxyImpl::AdjustConstraint(gcConstraints->MaxOldSpaceSize), V8IsolateProxyImpl::AdjustConstraint(gcConstraints->MaxExecutableSize));
+            pConstraints = &constraints;
+        }
+
+        try
+        {
+            m_pspIsolateGroup = new SharedPtr<V8IsolateGroup>(V8IsolateGroup::Create(StdString(gcName), pConstraints, std::max(isolateCount, 1), V8DocumentInfo(documentInfo), StdString(gcCode)));
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    Int32 V8IsolateGroupProxyImpl::IsolateCount::get()
+    {
+        return static_cast<Int32>(GetIsolateGroup()->GetIsolateCount());
+    }
+
+    //-------------------------------------------------------------------------
+
+    array<Object^>^ V8IsolateGroupProxyImpl::Invoke(array<Object^>^ gcRecords, Int32 batchSize)
+    {
+        auto recordCount = gcRecords->Length;
+
+        std::vector<V8Value> records;
+        records.reserve(recordCount);
+
+        for (auto index = 0; index < recordCount; index++)
+        {
+            records.push_back(V8ContextProxyImpl::ImportValue(gcRecords[index]));
+
+            // records are shared by all isolates, so they must not refer to script or host objects
+            V8ObjectHolder* pV8ObjectHolder;
+            HostObjectHolder* pHostObjectHolder;
+            V8Value::Subtype subtype;
+            if (records.back().AsV8Object(pV8ObjectHolder, subtype) || records.back().AsHostObject(pHostObjectHolder))
+            {
+                throw gcnew ArgumentException(L"Records must be primitive values", L"records");
+            }
+        }
+
+        std::vector<V8Value> results;
+
+        try
+        {
+            GetIsolateGroup()->Invoke(records, static_cast<size_t>(std::max(batchSize, 1)), results);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+
+        auto gcResults = gcnew array<Object^>(recordCount);
+        for (auto index = 0; index < recordCount; index++)
+        {
+            gcResults[index] = V8ContextProxyImpl::ExportValue(results[index]);
+        }
+
+        return gcResults;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void V8IsolateGroupProxyImpl::GetStatistics([Out] UInt64% batchCount, [Out] UInt64% recordCount, [Out] UInt64% stealCount)
+    {
+        V8IsolateGroup::Statistics statistics;
+        GetIsolateGroup()->GetStatistics(statistics);
+
+        batchCount = statistics.BatchCount;
+        recordCount = statistics.RecordCount;
+        stealCount = statistics.StealCount;
+    }
+
+    //-------------------------------------------------------------------------
+
+    V8IsolateGroupProxyImpl::~V8IsolateGroupProxyImpl()
+    {
+        SharedPtr<V8IsolateGroup> spIsolateGroup;
+
+        BEGIN_LOCK_SCOPE(m_gcLock)
+
+            if (m_pspIsolateGroup != nullptr)
+            {
+                // hold V8 isolate group for destruction outside lock scope
+                spIsolateGroup = *m_pspIsolateGroup;
+                delete m_pspIsolateGroup;
+                m_pspIsolateGroup = nullptr;
+            }
+
+        END_LOCK_SCOPE
+
+        if (!spIsolateGroup.IsEmpty())
+        {
+            GC::SuppressFinalize(this);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    V8IsolateGroupProxyImpl::!V8IsolateGroupProxyImpl()
+    {
+        if (m_pspIsolateGroup != nullptr)
+        {
+            delete m_pspIsolateGroup;
+            m_pspIsolateGroup = nullptr;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    SharedPtr<V8IsolateGroup> V8IsolateGroupProxyImpl::GetIsolateGroup()
+    {
+        BEGIN_LOCK_SCOPE(m_gcLock)
+
+            if (m_pspIsolateGroup == nullptr)
+            {
+                throw gcnew ObjectDisposedException(ToString());
+            }
+
+            return *m_pspIsolateGroup;
+
+        END_LOCK_SCOPE
+    }
+
+}}}
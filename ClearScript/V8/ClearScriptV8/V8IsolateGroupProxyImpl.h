@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+namespace Microsoft {
+namespace ClearScript {
+namespace V8 {
+
+    //-------------------------------------------------------------------------
+    // V8IsolateGroupProxyImpl
+    //-------------------------------------------------------------------------
+
+    private ref class V8IsolateGroupProxyImpl : V8IsolateGroupProxy
+    {
+    public:
+
+        V8IsolateGroupProxyImpl(String^ gcName, V8RuntimeConstraints^ gcConstraints, Int32 isolateCount, DocumentInfo documentInfo, String^ gcCode);
+
+        property Int32 IsolateCount
+        {
+            virtual Int32 get() override;
+        }
+
+        virtual array<Object^>^ Invoke(array<Object^>^ gcRecords, Int32 batchSize) override;
+        virtual void GetStatistics([Out] UInt64% batchCount, [Out] UInt64% recordCount, [Out] UInt64% stealCount) override;
+
+        ~V8IsolateGroupProxyImpl();
+        !V8IsolateGroupProxyImpl();
+
+    private:
+
+        SharedPtr<V8IsolateGroup> GetIsolateGroup();
+
+        Object^ m_gcLock;
+        SharedPtr<V8IsolateGroup>* m_pspIsolateGroup;
+    };
+
+}}}
@@ -3,6 +3,62 @@
 
 #pragma once
 
+//-----------------------------------------------------------------------------
+// V8IsolateHeapSpaceInfo
+//-----------------------------------------------------------------------------
+
+class V8IsolateHeapSpaceInfo
+{
+public:
+
+    V8IsolateHeapSpaceInfo()
+    {
+    }
+
+    void Set(const char* pName, size_t size, size_t usedSize, size_t availableSize, size_t physicalSize)
+    {
+        m_pName = pName;
+        m_Size = size;
+        m_UsedSize = usedSize;
+        m_AvailableSize = availableSize;
+        m_PhysicalSize = physicalSize;
+    }
+
+    const char* GetName() const
+    {
+        return m_pName;
+    }
+
+    size_t GetSize() const
+    {
+        return m_Size;
+    }
+
+    size_t GetUsedSize() const
+    {
+        return m_UsedSize;
+    }
+
+    size_t GetAvailableSize() const
+    {
+        return m_AvailableSize;
+    }
+
+    size_t GetPhysicalSize() const
+    {
+        return m_PhysicalSize;
+    }
+
+private:
+
+    // V8 space names are static strings
+    const char* m_pName = nullptr;
+    size_t m_Size = 0;
+    size_t m_UsedSize = 0;
+    size_t m_AvailableSize = 0;
+    size_t m_PhysicalSize = 0;
+};
+
 //-----------------------------------------------------------------------------
 // V8IsolateHeapInfo
 //-----------------------------------------------------------------------------
@@ -49,11 +105,122 @@ public:
         return m_HeapSizeLimit;
     }
 
+    void SetArrayBufferInfo(size_t arrayBufferSize, size_t peakArrayBufferSize, size_t arrayBufferCount)
+    {
+        m_ArrayBufferSize = arrayBufferSize;
+        m_PeakArrayBufferSize = peakArrayBufferSize;
+        m_ArrayBufferCount = arrayBufferCount;
+    }
+
+    size_t GetArrayBufferSize() const
+    {
+        return m_ArrayBufferSize;
+    }
+
+    size_t GetPeakArrayBufferSize() const
+    {
+        return m_PeakArrayBufferSize;
+    }
+
+    size_t GetArrayBufferCount() const
+    {
+        return m_ArrayBufferCount;
+    }
+
+    void SetExtendedInfo(size_t totalAvailableSize, size_t mallocedMemory, size_t peakMallocedMemory, size_t externalMemory, size_t nativeContextCount, size_t detachedContextCount)
+    {
+        m_TotalAvailableSize = totalAvailableSize;
+        m_MallocedMemory = mallocedMemory;
+        m_PeakMallocedMemory = peakMallocedMemory;
+        m_ExternalMemory = externalMemory;
+        m_NativeContextCount = nativeContextCount;
+        m_DetachedContextCount = detachedContextCount;
+    }
+
+    size_t GetTotalAvailableSize() const
+    {
+        return m_TotalAvailableSize;
+    }
+
+    size_t GetMallocedMemory() const
+    {
+        return m_MallocedMemory;
+    }
+
+    size_t GetPeakMallocedMemory() const
+    {
+        return m_PeakMallocedMemory;
+    }
+
+    size_t GetExternalMemory() const
+    {
+        return m_ExternalMemory;
+    }
+
+    size_t GetNativeContextCount() const
+    {
+        return m_NativeContextCount;
+    }
+
+    size_t GetDetachedContextCount() const
+    {
+        return m_DetachedContextCount;
+    }
+
+    std::vector<V8IsolateHeapSpaceInfo>& GetSpaceInfo()
+    {
+        return m_SpaceInfo;
+    }
+
+    const std::vector<V8IsolateHeapSpaceInfo>& GetSpaceInfo() const
+    {
+        return m_SpaceInfo;
+    }
+
+    void SetAllocationInfo(double sampleTime, size_t totalAllocatedSize)
+    {
+        m_SampleTime = sampleTime;
+        m_TotalAllocatedSize = totalAllocatedSize;
+    }
+
+    double GetSampleTime() const
+    {
+        return m_SampleTime;
+    }
+
+    size_t GetTotalAllocatedSize() const
+    {
+        return m_TotalAllocatedSize;
+    }
+
+    void SetAllocationRate(double allocationRate)
+    {
+        m_AllocationRate = allocationRate;
+    }
+
+    double GetAllocationRate() const
+    {
+        return m_AllocationRate;
+    }
+
 private:
 
-    size_t m_TotalHeapSize;
-    size_t m_TotalHeapSizeExecutable;
-    size_t m_TotalPhysicalSize;
-    size_t m_UsedHeapSize;
-    size_t m_HeapSizeLimit;
+    size_t m_TotalHeapSize = 0;
+    size_t m_TotalHeapSizeExecutable = 0;
+    size_t m_TotalPhysicalSize = 0;
+    size_t m_UsedHeapSize = 0;
+    size_t m_HeapSizeLimit = 0;
+    size_t m_ArrayBufferSize = 0;
+    size_t m_PeakArrayBufferSize = 0;
+    size_t m_ArrayBufferCount = 0;
+    size_t m_TotalAvailableSize = 0;
+    size_t m_MallocedMemory = 0;
+    size_t m_PeakMallocedMemory = 0;
+    size_t m_ExternalMemory = 0;
+    size_t m_NativeContextCount = 0;
+    size_t m_DetachedContextCount = 0;
+    std::vector<V8IsolateHeapSpaceInfo> m_SpaceInfo;
+    double m_SampleTime = 0;
+    size_t m_TotalAllocatedSize = 0;
+    double m_AllocationRate = 0;
 };
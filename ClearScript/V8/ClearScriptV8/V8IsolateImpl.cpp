@@ -3,6 +3,57 @@
 
 #include "ClearScriptV8Native.h"
 
+//-----------------------------------------------------------------------------
+// V8DetachedTaskRunner
+//-----------------------------------------------------------------------------
+
+class V8DetachedTaskRunner: public v8::TaskRunner
+{
+    PROHIBIT_COPY(V8DetachedTaskRunner)
+
+public:
+
+    V8DetachedTaskRunner();
+
+    virtual void PostTask(std::unique_ptr<v8::Task> spTask) override;
+    virtual void PostDelayedTask(std::unique_ptr<v8::Task> spTask, double delayInSeconds) override;
+    virtual void PostIdleTask(std::unique_ptr<v8::IdleTask> spTask) override;
+    virtual bool IdleTasksEnabled() override;
+};
+
+//-----------------------------------------------------------------------------
+
+V8DetachedTaskRunner::V8DetachedTaskRunner()
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void V8DetachedTaskRunner::PostTask(std::unique_ptr<v8::Task> /*spTask*/)
+{
+    // This task runner serves isolates that have no V8IsolateImpl instance (e.g., snapshot
+    // creation isolates). Such isolates never process foreground tasks; discard the task.
+}
+
+//-----------------------------------------------------------------------------
+
+void V8DetachedTaskRunner::PostDelayedTask(std::unique_ptr<v8::Task> /*spTask*/, double /*delayInSeconds*/)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void V8DetachedTaskRunner::PostIdleTask(std::unique_ptr<v8::IdleTask> /*spTask*/)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8DetachedTaskRunner::IdleTasksEnabled()
+{
+    return false;
+}
+
 //-----------------------------------------------------------------------------
 // V8Platform
 //-----------------------------------------------------------------------------
@@ -14,12 +65,19 @@ public:
     static V8Platform& GetInstance();
     static void EnsureInstalled();
 
+    V8WorkerPool& GetWorkerPool() { return *m_pWorkerPool; }
+    bool HasWorkerPool() const { return m_pWorkerPool != nullptr; }
+    V8TimerWheel& GetTimerWheel() { return *m_pTimerWheel; }
+
     virtual int NumberOfWorkerThreads() override;
     virtual std::shared_ptr<v8::TaskRunner> GetForegroundTaskRunner(v8::Isolate* pIsolate) override;
     virtual void CallOnWorkerThread(std::unique_ptr<v8::Task> spTask) override;
+    virtual void CallBlockingTaskOnWorkerThread(std::unique_ptr<v8::Task> spTask) override;
     virtual void CallDelayedOnWorkerThread(std::unique_ptr<v8::Task> spTask, double delayInSeconds) override;
     virtual void CallOnForegroundThread(v8::Isolate* pIsolate, v8::Task* pTask) override;
     virtual void CallDelayedOnForegroundThread(v8::Isolate* pIsolate, v8::Task* pTask, double delayInSeconds) override;
+    virtual void CallIdleOnForegroundThread(v8::Isolate* pIsolate, v8::IdleTask* pTask) override;
+    virtual bool IdleTasksEnabled(v8::Isolate* pIsolate) override;
     virtual double MonotonicallyIncreasingTime() override;
     virtual double CurrentClockTimeMillis() override;
     virtual v8::TracingController* GetTracingController() override;
@@ -28,9 +86,14 @@ private:
 
     V8Platform();
 
+    void PostWorkerTask(std::unique_ptr<v8::Task> spTask, V8WorkerPool::Priority priority);
+
     static V8Platform ms_Instance;
     static OnceFlag ms_InstallationFlag;
     v8::TracingController m_TracingController;
+    std::shared_ptr<v8::TaskRunner> m_spDetachedTaskRunner;
+    V8WorkerPool* m_pWorkerPool;
+    V8TimerWheel* m_pTimerWheel;
 };
 
 //-----------------------------------------------------------------------------
@@ -46,6 +109,12 @@ void V8Platform::EnsureInstalled()
 {
     ms_InstallationFlag.CallOnce([]
     {
+        // The worker pool and timer wheel live for the life of the process. Joining their threads
+        // during module unload could deadlock, so they're never destroyed.
+
+        ms_Instance.m_pWorkerPool = new V8WorkerPool(static_cast<size_t>(ms_Instance.NumberOfWorkerThreads()));
+        ms_Instance.m_pTimerWheel = new V8TimerWheel;
+
         v8::V8::InitializePlatform(&ms_Instance);
         ASSERT_EVAL(v8::V8::Initialize());
     });
@@ -62,22 +131,28 @@ int V8Platform::NumberOfWorkerThreads()
 
 std::shared_ptr<v8::TaskRunner> V8Platform::GetForegroundTaskRunner(v8::Isolate* pIsolate)
 {
-    return V8IsolateImpl::GetInstanceFromIsolate(pIsolate)->GetForegroundTaskRunner();
+    auto pIsolateImpl = V8IsolateImpl::GetInstanceFromIsolate(pIsolate);
+    if (pIsolateImpl == nullptr)
+    {
+        return m_spDetachedTaskRunner;
+    }
+
+    return pIsolateImpl->GetForegroundTaskRunner();
 }
 
 //-----------------------------------------------------------------------------
 
 void V8Platform::CallOnWorkerThread(std::unique_ptr<v8::Task> spTask)
 {
-    auto pIsolate = v8::Isolate::GetCurrent();
-    if (pIsolate == nullptr)
-    {
-        spTask->Run();
-    }
-    else
-    {
-		V8IsolateImpl::GetInstanceFromIsolate(pIsolate)->RunTaskAsync(spTask.release());
-    }
+    PostWorkerTask(std::move(spTask), V8WorkerPool::Priority::Normal);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8Platform::CallBlockingTaskOnWorkerThread(std::unique_ptr<v8::Task> spTask)
+{
+    // V8 posts blocking tasks when the calling thread is about to wait for their completion
+    PostWorkerTask(std::move(spTask), V8WorkerPool::Priority::High);
 }
 
 //-----------------------------------------------------------------------------
@@ -85,9 +160,10 @@ void V8Platform::CallOnWorkerThread(std::unique_ptr<v8::Task> spTask)
 void V8Platform::CallDelayedOnWorkerThread(std::unique_ptr<v8::Task> spTask, double delayInSeconds)
 {
     auto pIsolate = v8::Isolate::GetCurrent();
-    if (pIsolate != nullptr)
+    auto pIsolateImpl = (pIsolate != nullptr) ? V8IsolateImpl::GetInstanceFromIsolate(pIsolate) : nullptr;
+    if (pIsolateImpl != nullptr)
     {
-		V8IsolateImpl::GetInstanceFromIsolate(pIsolate)->RunTaskDelayed(spTask.release(), delayInSeconds);
+		pIsolateImpl->RunTaskDelayed(spTask.release(), delayInSeconds);
     }
 }
 
@@ -95,14 +171,28 @@ void V8Platform::CallDelayedOnWorkerThread(std::unique_ptr<v8::Task> spTask, dou
 
 void V8Platform::CallOnForegroundThread(v8::Isolate* pIsolate, v8::Task* pTask)
 {
-	V8IsolateImpl::GetInstanceFromIsolate(pIsolate)->RunTaskWithLockAsync(pTask);
+    GetForegroundTaskRunner(pIsolate)->PostTask(std::unique_ptr<v8::Task>(pTask));
 }
 
 //-----------------------------------------------------------------------------
 
 void V8Platform::CallDelayedOnForegroundThread(v8::Isolate* pIsolate, v8::Task* pTask, double delayInSeconds)
 {
-	V8IsolateImpl::GetInstanceFromIsolate(pIsolate)->RunTaskWithLockDelayed(pTask, delayInSeconds);
+    GetForegroundTaskRunner(pIsolate)->PostDelayedTask(std::unique_ptr<v8::Task>(pTask), delayInSeconds);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8Platform::CallIdleOnForegroundThread(v8::Isolate* pIsolate, v8::IdleTask* pTask)
+{
+    GetForegroundTaskRunner(pIsolate)->PostIdleTask(std::unique_ptr<v8::IdleTask>(pTask));
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8Platform::IdleTasksEnabled(v8::Isolate* pIsolate)
+{
+    return GetForegroundTaskRunner(pIsolate)->IdleTasksEnabled();
 }
 
 //-----------------------------------------------------------------------------
@@ -128,8 +218,32 @@ v8::TracingController* V8Platform::GetTracingController()
 
 //-----------------------------------------------------------------------------
 
-V8Platform::V8Platform()
+V8Platform::V8Platform():
+    m_spDetachedTaskRunner(std::make_shared<V8DetachedTaskRunner>()),
+    m_pWorkerPool(nullptr),
+    m_pTimerWheel(nullptr)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void V8Platform::PostWorkerTask(std::unique_ptr<v8::Task> spTask, V8WorkerPool::Priority priority)
 {
+    auto pIsolate = v8::Isolate::GetCurrent();
+    auto pIsolateImpl = (pIsolate != nullptr) ? V8IsolateImpl::GetInstanceFromIsolate(pIsolate) : nullptr;
+    if (pIsolateImpl == nullptr)
+    {
+        // no isolate to track the task against; it's still run on a worker thread, not here
+        std::shared_ptr<v8::Task> spSharedTask(spTask.release());
+        GetWorkerPool().PostTask(priority, [spSharedTask] ()
+        {
+            spSharedTask->Run();
+        });
+    }
+    else
+    {
+        pIsolateImpl->RunTaskAsync(spTask.release(), priority);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -198,76 +312,20 @@ void V8ForegroundTaskRunner::PostDelayedTask(std::unique_ptr<v8::Task> spTask, d
 
 void V8ForegroundTaskRunner::PostIdleTask(std::unique_ptr<v8::IdleTask> spTask)
 {
-    // unexpected call to unsupported method
-    std::terminate();
+    auto spIsolate = m_wrIsolate.GetTarget();
+    if (!spIsolate.IsEmpty())
+    {
+        m_pIsolateImpl->PostIdleTask(std::move(spTask));
+    }
 }
 
 //-----------------------------------------------------------------------------
 
 bool V8ForegroundTaskRunner::IdleTasksEnabled()
 {
-    return false;
-}
-
-//-----------------------------------------------------------------------------
-// V8ArrayBufferAllocator
-//-----------------------------------------------------------------------------
-
-class V8ArrayBufferAllocator: public v8::ArrayBuffer::Allocator
-{
-public:
-
-    static V8ArrayBufferAllocator& GetInstance();
-
-    virtual void* Allocate(size_t size) override;
-    virtual void* AllocateUninitialized(size_t size) override;
-    virtual void Free(void* pvData, size_t size) override;
-
-private:
-
-    V8ArrayBufferAllocator();
-
-    static V8ArrayBufferAllocator ms_Instance;
-};
-
-//-----------------------------------------------------------------------------
-
-V8ArrayBufferAllocator& V8ArrayBufferAllocator::GetInstance()
-{
-    return ms_Instance;
-}
-
-//-----------------------------------------------------------------------------
-
-void* V8ArrayBufferAllocator::Allocate(size_t size)
-{
-    return ::calloc(1, size);
-}
-
-//-----------------------------------------------------------------------------
-
-void* V8ArrayBufferAllocator::AllocateUninitialized(size_t size)
-{
-    return ::malloc(size);
-}
-
-//-----------------------------------------------------------------------------
-
-void V8ArrayBufferAllocator::Free(void* pvData, size_t /*size*/)
-{
-    ::free(pvData);
-}
-
-//-----------------------------------------------------------------------------
-
-V8ArrayBufferAllocator::V8ArrayBufferAllocator()
-{
+    return true;
 }
 
-//-----------------------------------------------------------------------------
-
-V8ArrayBufferAllocator V8ArrayBufferAllocator::ms_Instance;
-
 //-----------------------------------------------------------------------------
 // V8IsolateImpl implementation
 //-----------------------------------------------------------------------------
@@ -298,19 +356,35 @@ static const int s_ContextGroupId = 1;
 static const size_t s_StackBreathingRoom = static_cast<size_t>(16 * 1024);
 static size_t* const s_pMinStackLimit = reinterpret_cast<size_t*>(sizeof(size_t));
 static std::atomic<size_t> s_InstanceCount(0);
+static std::atomic<std::uint64_t> s_IdleTaskPostedCount(0);
+static std::atomic<std::uint64_t> s_IdleTaskRunCount(0);
 static thread_local V8IsolateImpl* s_pInstanceInConstructor = nullptr;
 
 //-----------------------------------------------------------------------------
 
 V8IsolateImpl::V8IsolateImpl(const StdString& name, const V8IsolateConstraints* pConstraints, const Options& options):
     m_Name(name),
+    m_SnapshotData { nullptr, 0 },
+    m_MutexLockDepth(0),
+    m_MutexWaiterCount(0),
+    m_MutexHandoffCount(0),
+    m_TimeSliceInterval(0),
+    m_TimeSliceStartTime(0),
+    m_ThreadAffine(options.EnableThreadAffinity),
+    m_OwnerThreadId(std::this_thread::get_id()),
+    m_CallWithLockInterruptPending(false),
     m_DebuggingEnabled(false),
     m_AwaitingDebugger(false),
     m_InMessageLoop(false),
     m_QuitMessageLoop(false),
     m_AbortMessageLoop(false),
     m_MaxHeapSize(0),
+    m_HeapSizeSampleInterval(0),
     m_HeapWatchLevel(0),
+    m_HeapSizeCheckPending(false),
+    m_HeapSizeCheckTime(0),
+    m_HeapAllocatedSize(0),
+    m_HeapUsedSizeAfterGC(0),
     m_MaxStackUsage(0),
     m_StackWatchLevel(0),
     m_pStackLimit(nullptr),
@@ -322,18 +396,44 @@ V8IsolateImpl::V8IsolateImpl(const StdString& name, const V8IsolateConstraints*
     V8Platform::EnsureInstalled();
 
     v8::Isolate::CreateParams params;
-    params.array_buffer_allocator = &V8ArrayBufferAllocator::GetInstance();
+    // the allocator must outlive the isolate
+    m_spArrayBufferAllocator.reset(new V8ArrayBufferAllocator);
+    params.array_buffer_allocator = m_spArrayBufferAllocator.get();
     if (pConstraints != nullptr)
     {
         params.constraints.set_max_semi_space_size_in_kb(static_cast<size_t>(pConstraints->GetMaxNewSpaceSize()) * 1024);
         params.constraints.set_max_old_space_size(pConstraints->GetMaxOldSpaceSize());
     }
 
+    if (!options.SnapshotBlob.IsEmpty())
+    {
+        // V8 retains the startup data pointer; the blob must outlive the isolate
+        m_spSnapshotBlob = options.SnapshotBlob;
+        m_SnapshotData.data = m_spSnapshotBlob->GetData();
+        m_SnapshotData.raw_size = m_spSnapshotBlob->GetSize();
+
+        params.snapshot_blob = &m_SnapshotData;
+        params.external_references = V8ContextImpl::GetExternalReferences();
+    }
+
 	BEGIN_PULSE_VALUE_SCOPE(&s_pInstanceInConstructor, this)
 		m_pIsolate = v8::Isolate::New(params);
 	END_PULSE_VALUE_SCOPE
 
     m_pIsolate->AddBeforeCallEnteredCallback(OnBeforeCallEntered);
+    m_pIsolate->AddGCPrologueCallback(OnGCPrologue, this);
+    m_pIsolate->AddGCEpilogueCallback(OnGCEpilogue, this);
+    m_pIsolate->AddNearHeapLimitCallback(OnNearHeapLimit, this);
+
+    if (m_ThreadAffine)
+    {
+        // The owner thread locks and enters the isolate once, for the life of the instance. Its
+        // isolate scopes then need neither the instance mutex nor a V8 locker, and entering the
+        // isolate again is just a nesting count update.
+
+        m_spOwnerLocker.reset(new v8::Locker(m_pIsolate));
+        m_pIsolate->Enter();
+    }
 
     BEGIN_ADDREF_SCOPE
     BEGIN_ISOLATE_SCOPE
@@ -341,8 +441,22 @@ V8IsolateImpl::V8IsolateImpl(const StdString& name, const V8IsolateConstraints*
         m_pIsolate->SetData(0, this);
         m_pIsolate->SetCaptureStackTraceForUncaughtExceptions(true, 64, v8::StackTrace::kDetailed);
 
+        if (options.EnableExplicitMicrotasks)
+        {
+            m_pIsolate->SetMicrotasksPolicy(v8::MicrotasksPolicy::kExplicit);
+        }
+
         m_hHostObjectHolderKey = CreatePersistent(CreatePrivate());
 
+        // allocation tracking starts from the initial heap
+        v8::HeapStatistics heapStatistics;
+        m_pIsolate->GetHeapStatistics(&heapStatistics);
+        m_HeapUsedSizeAfterGC = heapStatistics.used_heap_size();
+
+        V8IsolateHeapInfo heapInfo;
+        CaptureHeapInfo(heapInfo);
+        m_HeapInfoAllocationSample.Time = m_SnapshotAllocationSample.Time = heapInfo.GetSampleTime();
+
         if (options.EnableDebugging)
         {
             EnableDebugging(options.DebugPort, options.EnableRemoteDebugging);
@@ -371,6 +485,100 @@ size_t V8IsolateImpl::GetInstanceCount()
 
 //-----------------------------------------------------------------------------
 
+void V8IsolateImpl::GetWorkerPoolStatistics(WorkerPoolStatistics& statistics)
+{
+    auto& platform = V8Platform::GetInstance();
+    if (platform.HasWorkerPool())
+    {
+        auto& workerPool = platform.GetWorkerPool();
+        statistics.ThreadCount = workerPool.GetThreadCount();
+        workerPool.GetStatistics(statistics.QueueDepth, statistics.TaskCount, statistics.StealCount);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::GetIdleTaskCounts(std::uint64_t& postedCount, std::uint64_t& runCount)
+{
+    postedCount = s_IdleTaskPostedCount;
+    runCount = s_IdleTaskRunCount;
+}
+
+//-----------------------------------------------------------------------------
+
+V8SnapshotBlob* V8IsolateImpl::CreateSnapshotBlob(const StdString& name, const StdString& warmUpCode)
+{
+    V8Platform::EnsureInstalled();
+
+    v8::StartupData startupData { nullptr, 0 };
+    StdString message;
+
+    {
+        // The snapshot creator owns a private isolate with no V8IsolateImpl instance. Only the
+        // default context is serialized; ClearScript contexts bind their templates to native
+        // instance data and are therefore always built at runtime on top of this context.
+
+        v8::SnapshotCreator snapshotCreator(V8ContextImpl::GetExternalReferences());
+        auto pIsolate = snapshotCreator.GetIsolate();
+
+        {
+            v8::HandleScope handleScope(pIsolate);
+            auto hContext = v8::Context::New(pIsolate);
+
+            {
+                v8::Context::Scope contextScope(hContext);
+                v8::TryCatch tryCatch(pIsolate);
+
+                v8::Local<v8::String> hName;
+                v8::Local<v8::String> hCode;
+                v8::Local<v8::Script> hScript;
+                v8::Local<v8::Value> hResult;
+
+                if (!name.ToV8String(pIsolate).ToLocal(&hName) || !warmUpCode.ToV8String(pIsolate).ToLocal(&hCode))
+                {
+                    message = StdString(L"The V8 runtime cannot allocate the snapshot warm-up script");
+                }
+                else
+                {
+                    v8::ScriptCompiler::Source source(hCode, v8::ScriptOrigin(hName));
+                    if (!v8::ScriptCompiler::Compile(hContext, &source).ToLocal(&hScript) || !hScript->Run(hContext).ToLocal(&hResult))
+                    {
+                        message = tryCatch.HasCaught() ? StdString(pIsolate, tryCatch.Exception()) : StdString(L"Snapshot warm-up script execution failed; no additional information was provided by the V8 runtime");
+                    }
+                }
+            }
+
+            snapshotCreator.SetDefaultContext(hContext);
+        }
+
+        // the snapshot creator must produce a blob before disposal, even on failure
+        startupData = snapshotCreator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+    }
+
+    V8SnapshotBlob* pSnapshotBlob = nullptr;
+    if ((message.GetLength() < 1) && (startupData.data != nullptr) && (startupData.raw_size > 0))
+    {
+        pSnapshotBlob = new V8SnapshotBlob(startupData.data, static_cast<size_t>(startupData.raw_size));
+    }
+
+    // V8 allocated the blob, so it must also release it (see V8Patch.txt)
+    startupData.DeleteData();
+
+    if (pSnapshotBlob == nullptr)
+    {
+        if (message.GetLength() < 1)
+        {
+            message = StdString(L"The V8 runtime cannot create the requested snapshot");
+        }
+
+        throw V8Exception(V8Exception::Type::General, name, std::move(message), false /*executionStarted*/);
+    }
+
+    return pSnapshotBlob;
+}
+
+//-----------------------------------------------------------------------------
+
 void V8IsolateImpl::AddContext(V8ContextImpl* pContextImpl, const V8Context::Options& options)
 {
     _ASSERTE(IsCurrent() && IsLocked());
@@ -496,6 +704,20 @@ void V8IsolateImpl::SetHeapSizeSampleInterval(double value)
 
 //-----------------------------------------------------------------------------
 
+double V8IsolateImpl::GetTimeSliceInterval()
+{
+    return m_TimeSliceInterval;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::SetTimeSliceInterval(double value)
+{
+    m_TimeSliceInterval = value;
+}
+
+//-----------------------------------------------------------------------------
+
 size_t V8IsolateImpl::GetMaxStackUsage()
 {
     return m_MaxStackUsage;
@@ -570,22 +792,40 @@ V8ScriptHolder* V8IsolateImpl::Compile(const V8DocumentInfo& documentInfo, const
 
 //-----------------------------------------------------------------------------
 
-void V8IsolateImpl::GetHeapInfo(V8IsolateHeapInfo& heapInfo)
+SharedPtr<V8ScriptCompilation> V8IsolateImpl::CompileAsync(const V8DocumentInfo& documentInfo, const StdString& code)
 {
     BEGIN_ISOLATE_SCOPE
 
-    v8::HeapStatistics heapStatistics;
-    m_pIsolate->GetHeapStatistics(&heapStatistics);
+        SharedPtr<V8ContextImpl> spContextImpl((m_ContextPtrs.size() > 0) ? m_ContextPtrs.front() : new V8ContextImpl(this));
+        return spContextImpl->CompileAsync(documentInfo, code);
 
-    heapInfo.Set(
-        heapStatistics.total_heap_size(),
-        heapStatistics.total_heap_size_executable(),
-        heapStatistics.total_physical_size(),
-        heapStatistics.used_heap_size(),
-        heapStatistics.heap_size_limit()
-    );
+    END_ISOLATE_SCOPE
+}
+
+//-----------------------------------------------------------------------------
 
+void V8IsolateImpl::GetHeapInfo(V8IsolateHeapInfo& heapInfo)
+{
+    BEGIN_ISOLATE_SCOPE
+        CaptureHeapInfo(heapInfo);
     END_ISOLATE_SCOPE
+
+    BEGIN_MUTEX_SCOPE(m_HeapInfoMutex)
+        SetAllocationRate(heapInfo, m_HeapInfoAllocationSample);
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::GetHeapInfoSnapshot(V8IsolateHeapInfo& heapInfo)
+{
+    // The snapshot is refreshed after each full garbage collection and by GetHeapInfo. Reading
+    // it takes neither the isolate lock nor a V8 call, so it doesn't wait for running script code.
+
+    BEGIN_MUTEX_SCOPE(m_HeapInfoMutex)
+        heapInfo = m_HeapInfoSnapshot;
+        SetAllocationRate(heapInfo, m_SnapshotAllocationSample);
+    END_MUTEX_SCOPE
 }
 
 //-----------------------------------------------------------------------------
@@ -608,32 +848,157 @@ void V8IsolateImpl::CollectGarbage(bool exhaustive)
 
 //-----------------------------------------------------------------------------
 
-void V8IsolateImpl::runMessageLoopOnPause(int /*contextGroupId*/)
+void V8IsolateImpl::NotifyIdle(double idleTimeInSeconds)
 {
-    RunMessageLoop(false);
-}
+    BEGIN_ISOLATE_SCOPE
 
-//-----------------------------------------------------------------------------
+    auto& platform = V8Platform::GetInstance();
+    auto deadline = platform.MonotonicallyIncreasingTime() + std::max(idleTimeInSeconds, 0.0);
 
-void V8IsolateImpl::quitMessageLoopOnPause()
-{
-    _ASSERTE(IsCurrent() && IsLocked());
+    // Run pending idle tasks first; V8 posts them to finalize incremental marking and to drive its
+    // memory reducer. Any remaining time goes to V8's own idle-time garbage collection.
 
-    BEGIN_MUTEX_SCOPE(m_DataMutex)
-        m_QuitMessageLoop = true;
-    END_MUTEX_SCOPE
-}
+    while (platform.MonotonicallyIncreasingTime() < deadline)
+    {
+        std::unique_ptr<v8::IdleTask> spTask;
 
-//-----------------------------------------------------------------------------
+        BEGIN_MUTEX_SCOPE(m_DataMutex)
+            if (!m_IdleTasks.empty())
+            {
+                spTask = std::move(m_IdleTasks.front());
+                m_IdleTasks.pop_front();
+            }
+        END_MUTEX_SCOPE
 
-void V8IsolateImpl::runIfWaitingForDebugger(int /*contextGroupId*/)
-{
-    quitMessageLoopOnPause();
-}
+        if (!spTask)
+        {
+            break;
+        }
 
-//-----------------------------------------------------------------------------
+        spTask->Run(deadline);
+        ++s_IdleTaskRunCount;
+    }
 
-v8::Local<v8::Context> V8IsolateImpl::ensureDefaultContextInGroup(int contextGroupId)
+    if (platform.MonotonicallyIncreasingTime() < deadline)
+    {
+        IdleNotificationDeadline(deadline);
+    }
+
+    END_ISOLATE_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::DrainMicrotasks(double timeBudgetInSeconds)
+{
+    BEGIN_ISOLATE_SCOPE
+
+    // Microtasks are script code; like any other script execution, they run under heap and stack
+    // usage monitoring and can be interrupted by the host.
+
+    ExecutionScope executionScope(this);
+    TryCatch tryCatch(this);
+
+    auto& platform = V8Platform::GetInstance();
+    auto deadline = platform.MonotonicallyIncreasingTime() + std::max(timeBudgetInSeconds, 0.0);
+
+    // Each batch applies promise settlements queued by other threads and then runs a microtask
+    // checkpoint. V8 runs a checkpoint to completion, so the budget is checked between batches.
+
+    do
+    {
+        ProcessCallWithLockQueueIfNecessary();
+        m_pIsolate->RunMicrotasks();
+
+        if (IsExecutionTerminating() || (tryCatch.HasCaught() && !tryCatch.CanContinue()))
+        {
+            if (IsOutOfMemory())
+            {
+                ThrowOutOfMemoryException();
+            }
+
+            throw V8Exception(V8Exception::Type::Interrupt, m_Name, StdString(L"Script execution interrupted by host"), executionScope.ExecutionStarted());
+        }
+    }
+    while (!m_CallWithLockQueue.IsEmpty() && (platform.MonotonicallyIncreasingTime() < deadline));
+
+    END_ISOLATE_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::SetCodeCacheDirectory(const StdString& directoryPath)
+{
+    SharedPtr<V8CodeCacheStore> spCodeCacheStore;
+    if (directoryPath.GetLength() > 0)
+    {
+        spCodeCacheStore = new V8CodeCacheStore(directoryPath);
+    }
+
+    BEGIN_MUTEX_SCOPE(m_DataMutex)
+        m_spCodeCacheStore = spCodeCacheStore;
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::GetCodeCacheInfo(V8IsolateCodeCacheInfo& codeCacheInfo)
+{
+    auto spCodeCacheStore = GetCodeCacheStore();
+    if (spCodeCacheStore.IsEmpty())
+    {
+        codeCacheInfo = V8IsolateCodeCacheInfo();
+    }
+    else
+    {
+        spCodeCacheStore->GetInfo(codeCacheInfo);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::GetCallWithLockLatencyHistogram(std::vector<std::uint64_t>& histogram)
+{
+    m_CallWithLockQueue.GetLatencyHistogram(histogram);
+}
+
+//-----------------------------------------------------------------------------
+
+SharedPtr<V8CodeCacheStore> V8IsolateImpl::GetCodeCacheStore()
+{
+    BEGIN_MUTEX_SCOPE(m_DataMutex)
+        return m_spCodeCacheStore;
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::runMessageLoopOnPause(int /*contextGroupId*/)
+{
+    RunMessageLoop(false);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::quitMessageLoopOnPause()
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    BEGIN_MUTEX_SCOPE(m_DataMutex)
+        m_QuitMessageLoop = true;
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::runIfWaitingForDebugger(int /*contextGroupId*/)
+{
+    quitMessageLoopOnPause();
+}
+
+//-----------------------------------------------------------------------------
+
+v8::Local<v8::Context> V8IsolateImpl::ensureDefaultContextInGroup(int contextGroupId)
 {
     _ASSERTE(IsCurrent() && IsLocked());
 
@@ -721,24 +1086,144 @@ void V8IsolateImpl::ReleaseV8Script(void* pvScript)
 
 //-----------------------------------------------------------------------------
 
-void V8IsolateImpl::RunTaskAsync(v8::Task* pTask)
+bool V8IsolateImpl::TryGetSharedScript(std::uint64_t id, const StdString& resourceName, v8::Local<v8::UnboundScript>& hScript)
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    auto it = m_SharedScripts.find(std::make_pair(id, resourceName));
+    if (it == m_SharedScripts.end())
+    {
+        return false;
+    }
+
+    hScript = CreateLocal(it->second.hScript);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::AddSharedScript(const SharedPtr<V8SharedScript>& spSharedScript, const StdString& resourceName, v8::Local<v8::UnboundScript> hScript)
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    // discard instances of shared scripts that are no longer referenced
+
+    for (auto it = m_SharedScripts.begin(); it != m_SharedScripts.end();)
+    {
+        if (it->second.wrSharedScript.GetTarget().IsEmpty())
+        {
+            Dispose(it->second.hScript);
+            it = m_SharedScripts.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    // an unbound script carries its resource name, so instances are kept per document name
+
+    auto key = std::make_pair(spSharedScript->GetId(), resourceName);
+    if (m_SharedScripts.find(key) == m_SharedScripts.end())
+    {
+        m_SharedScripts.emplace(std::move(key), SharedScriptEntry { spSharedScript->CreateWeakRef(), CreatePersistent(hScript) });
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+v8::Local<v8::ArrayBuffer> V8IsolateImpl::CreateExternalArrayBuffer(void* pvData, size_t size, HostObjectHelpers::NativeCallback&& releaseCallback)
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    // The ArrayBuffer uses the caller's memory in place. Because it's externalized, V8 never
+    // frees that memory; instead, the release callback is queued once the ArrayBuffer has
+    // been collected or the isolate has been torn down.
+
+    auto hArrayBuffer = v8::ArrayBuffer::New(m_pIsolate, pvData, size, v8::ArrayBufferCreationMode::kExternalized);
+    AddExternalArrayBuffer(hArrayBuffer, std::move(releaseCallback), SharedPtr<V8SharedArrayBufferStore>());
+    return hArrayBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+SharedPtr<V8SharedArrayBufferStore> V8IsolateImpl::GetSharedArrayBufferStore(v8::Local<v8::SharedArrayBuffer> hSharedArrayBuffer)
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    auto contents = hSharedArrayBuffer->GetContents();
+    if (hSharedArrayBuffer->IsExternal())
+    {
+        auto it = m_SharedArrayBuffers.find(contents.Data());
+        return (it != m_SharedArrayBuffers.end()) ? it->second->spSharedArrayBufferStore : SharedPtr<V8SharedArrayBufferStore>();
+    }
+
+    // Only ordinary allocations can be shared; WebAssembly memory reservations can't be
+    // released by the store. Empty buffers have nothing to share.
+
+    if ((contents.ByteLength() < 1) || (contents.AllocationMode() != v8::ArrayBuffer::Allocator::AllocationMode::kNormal))
+    {
+        return SharedPtr<V8SharedArrayBufferStore>();
+    }
+
+    // ownership of the memory moves from the isolate to the store
+
+    auto externalizedContents = hSharedArrayBuffer->Externalize();
+    m_spArrayBufferAllocator->Untrack(externalizedContents.ByteLength());
+
+    SharedPtr<V8SharedArrayBufferStore> spSharedArrayBufferStore(new V8SharedArrayBufferStore(externalizedContents.Data(), externalizedContents.ByteLength()));
+    AddExternalArrayBuffer(hSharedArrayBuffer, HostObjectHelpers::NativeCallback(), spSharedArrayBufferStore);
+    return spSharedArrayBufferStore;
+}
+
+//-----------------------------------------------------------------------------
+
+v8::Local<v8::SharedArrayBuffer> V8IsolateImpl::ImportSharedArrayBuffer(const SharedPtr<V8SharedArrayBufferStore>& spSharedArrayBufferStore)
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    // within an isolate, a backing store is always exposed via the same SharedArrayBuffer
+
+    auto it = m_SharedArrayBuffers.find(spSharedArrayBufferStore->GetData());
+    if (it != m_SharedArrayBuffers.end())
+    {
+        return CreateLocal(it->second->hArrayBuffer).As<v8::SharedArrayBuffer>();
+    }
+
+    auto hSharedArrayBuffer = v8::SharedArrayBuffer::New(m_pIsolate, spSharedArrayBufferStore->GetData(), spSharedArrayBufferStore->GetSize(), v8::ArrayBufferCreationMode::kExternalized);
+    AddExternalArrayBuffer(hSharedArrayBuffer, HostObjectHelpers::NativeCallback(), spSharedArrayBufferStore);
+    return hSharedArrayBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::RunTaskAsync(v8::Task* pTask, V8WorkerPool::Priority priority)
+{
+    RunTaskAsync(std::shared_ptr<v8::Task>(pTask), priority);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::RunTaskAsync(std::shared_ptr<v8::Task>&& spTask, V8WorkerPool::Priority priority)
 {
     if (m_Released)
     {
-        pTask->Run();
-        delete pTask;
+        spTask->Run();
     }
     else
     {
-        std::shared_ptr<v8::Task> spTask(pTask);
         std::weak_ptr<v8::Task> wpTask(spTask);
 
         BEGIN_MUTEX_SCOPE(m_DataMutex)
-            m_AsyncTasks.push_back(std::move(spTask));
+            m_AsyncTasks.insert(std::move(spTask));
         END_MUTEX_SCOPE
 
+        // V8 background work (concurrent marking, parallel scavenging, compilation) runs on the
+        // native worker pool rather than the managed thread pool, whose latency depends on
+        // unrelated host activity.
+
         auto wrIsolate = CreateWeakRef();
-        HostObjectHelpers::QueueNativeCallback([this, wrIsolate, wpTask] ()
+        V8Platform::GetInstance().GetWorkerPool().PostTask(priority, [this, wrIsolate, wpTask] ()
         {
             auto spIsolate = wrIsolate.GetTarget();
             if (!spIsolate.IsEmpty())
@@ -749,8 +1234,7 @@ void V8IsolateImpl::RunTaskAsync(v8::Task* pTask)
                     spTask->Run();
 
                     BEGIN_MUTEX_SCOPE(m_DataMutex)
-                        auto it = std::remove(m_AsyncTasks.begin(), m_AsyncTasks.end(), spTask);
-                        m_AsyncTasks.erase(it, m_AsyncTasks.end());
+                        m_AsyncTasks.erase(spTask);
                     END_MUTEX_SCOPE
                 }
             }
@@ -770,52 +1254,26 @@ void V8IsolateImpl::RunTaskDelayed(v8::Task* pTask, double delayInSeconds)
     {
         std::shared_ptr<v8::Task> spTask(pTask);
 
+        // Delayed tasks share the platform's timer wheel, grouped by isolate for bulk
+        // cancellation at teardown. A due task is handed to the worker pool so that it doesn't
+        // hold up the wheel's other timers.
+
         auto wrIsolate = CreateWeakRef();
-        SharedPtr<Timer> spTimer(new Timer(static_cast<int>(delayInSeconds * 1000), -1, [this, wrIsolate, spTask] (Timer* pTimer) mutable
+        V8Platform::GetInstance().GetTimerWheel().Schedule(this, delayInSeconds, [this, wrIsolate, spTask] (V8TimerWheel::TimerId /*timerId*/) mutable
         {
-            if (spTask)
+            auto spIsolate = wrIsolate.GetTarget();
+            if (!spIsolate.IsEmpty())
             {
-                auto spIsolate = wrIsolate.GetTarget();
-                if (!spIsolate.IsEmpty())
-                {
-                    spTask->Run();
-
-                    // Release the timer's strong task reference. Doing so avoids a deadlock when
-                    // spIsolate's implicit destruction below triggers immediate isolate teardown.
-
-                    spTask.reset();
-
-                    // the timer has fired; discard it
-
-                    BEGIN_MUTEX_SCOPE(m_DataMutex)
-                        auto it = std::remove(m_TaskTimers.begin(), m_TaskTimers.end(), pTimer);
-                        m_TaskTimers.erase(it, m_TaskTimers.end());
-                    END_MUTEX_SCOPE
-                }
-                else
-                {
-                    // Release the timer's strong task reference. Doing so avoids a deadlock if the
-                    // isolate is awaiting task completion on the managed finalization thread.
-
-                    spTask.reset();
-                }
+                RunTaskAsync(std::move(spTask), V8WorkerPool::Priority::Normal);
             }
-        }));
-
-        // hold on to the timer to ensure callback execution
-
-        BEGIN_MUTEX_SCOPE(m_DataMutex)
-            m_TaskTimers.push_back(spTimer);
-        END_MUTEX_SCOPE
-
-        // Release the local task reference explicitly. Doing so avoids a deadlock if the callback is
-        // executed synchronously. That shouldn't happen given the current timer implementation.
-
-        spTask.reset();
-
-        // now it's safe to start the timer
+            else
+            {
+                // Release the timer's strong task reference. Doing so ensures that the task is
+                // destroyed before the isolate that owns it.
 
-        spTimer->Start();
+                spTask.reset();
+            }
+        });
     }
 }
 
@@ -850,135 +1308,400 @@ void V8IsolateImpl::RunTaskWithLockDelayed(v8::Task* pTask, double delayInSecond
     {
         std::shared_ptr<v8::Task> spTask(pTask);
 
+        // The wheel's thread services every isolate's timers, so it must neither run tasks nor
+        // wait for an isolate lock, which can block (e.g., during a time-slice handoff). A due
+        // task is handed to the worker pool, which runs it with the lock.
+
         auto wrIsolate = CreateWeakRef();
-        SharedPtr<Timer> spTimer(new Timer(static_cast<int>(delayInSeconds * 1000), -1, [this, wrIsolate, spTask] (Timer* pTimer) mutable
+        V8Platform::GetInstance().GetTimerWheel().Schedule(this, delayInSeconds, [this, wrIsolate, spTask] (V8TimerWheel::TimerId /*timerId*/) mutable
         {
-            if (spTask)
+            auto spIsolate = wrIsolate.GetTarget();
+            if (!spIsolate.IsEmpty())
             {
-                auto spIsolate = wrIsolate.GetTarget();
-                if (!spIsolate.IsEmpty())
+                V8Platform::GetInstance().GetWorkerPool().PostTask(V8WorkerPool::Priority::Normal, [this, wrIsolate, spTask] () mutable
                 {
-                    CallWithLockNoWait([spTask] (V8IsolateImpl* /*pIsolateImpl*/)
+                    auto spIsolate = wrIsolate.GetTarget();
+                    if (!spIsolate.IsEmpty())
                     {
-                        spTask->Run();
-                    });
+                        CallWithLockNoWait([spTask] (V8IsolateImpl* /*pIsolateImpl*/)
+                        {
+                            spTask->Run();
+                        });
+                    }
 
-                    // Release the timer's strong task reference. Doing so avoids a deadlock when
-                    // spIsolate's implicit destruction below triggers immediate isolate teardown.
+                    // Release the strong task reference. Doing so ensures that the task is
+                    // destroyed before the isolate if spIsolate's implicit destruction below
+                    // triggers immediate isolate teardown.
 
                     spTask.reset();
+                });
+            }
 
-                    // the timer has fired; discard it
+            // Release the timer's strong task reference before spIsolate's implicit destruction
+            // below. The posted work item holds its own reference.
 
-                    BEGIN_MUTEX_SCOPE(m_DataMutex)
-                        auto it = std::remove(m_TaskTimers.begin(), m_TaskTimers.end(), pTimer);
-                        m_TaskTimers.erase(it, m_TaskTimers.end());
-                    END_MUTEX_SCOPE
-                }
-                else
-                {
-                    // Release the timer's strong task reference. Doing so avoids a deadlock if the
-                    // isolate is awaiting task completion on the managed finalization thread.
+            spTask.reset();
+        });
+    }
+}
 
-                    spTask.reset();
-                }
+//-----------------------------------------------------------------------------
+
+std::shared_ptr<v8::TaskRunner> V8IsolateImpl::GetForegroundTaskRunner()
+{
+    BEGIN_MUTEX_SCOPE(m_DataMutex)
+
+        if (!m_spForegroundTaskRunner)
+        {
+            m_spForegroundTaskRunner = std::make_shared<V8ForegroundTaskRunner>(this);
+        }
+
+        return m_spForegroundTaskRunner;
+
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::PostIdleTask(std::unique_ptr<v8::IdleTask>&& spTask)
+{
+    BEGIN_MUTEX_SCOPE(m_DataMutex)
+        m_IdleTasks.push_back(std::move(spTask));
+    END_MUTEX_SCOPE
+
+    ++s_IdleTaskPostedCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::CallWithLockNoWait(V8CallWithLockQueue::Callback&& callback)
+{
+    if (m_ThreadAffine)
+    {
+        if (IsOwnerThread())
+        {
+            // the callback may release this instance; hold it for destruction outside isolate scope
+            SharedPtr<V8IsolateImpl> spThis(this);
+
+            BEGIN_ISOLATE_NATIVE_SCOPE
+                callback(this);
+            END_ISOLATE_NATIVE_SCOPE
+        }
+        else
+        {
+            CallWithLockAsync(std::move(callback));
+        }
+    }
+    else if (TryLockMutex())
+    {
+        // the callback may release this instance; hold it for destruction outside isolate scope
+        SharedPtr<V8IsolateImpl> spThis(this);
+
+        MutexScope mutexScope(this, true);
+        BEGIN_ISOLATE_NATIVE_SCOPE
+            callback(this);
+        END_ISOLATE_NATIVE_SCOPE
+    }
+    else
+    {
+        CallWithLockAsync(std::move(callback));
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void DECLSPEC_NORETURN V8IsolateImpl::ThrowOutOfMemoryException()
+{
+    m_IsOutOfMemory = true;
+    throw V8Exception(V8Exception::Type::Fatal, m_Name, StdString(L"The V8 runtime has exceeded its memory limit"), (m_pExecutionScope != nullptr) ? m_pExecutionScope->ExecutionStarted() : false);
+}
+
+//-----------------------------------------------------------------------------
+
+void DECLSPEC_NORETURN V8IsolateImpl::ThrowThreadAffinityException()
+{
+    throw V8Exception(V8Exception::Type::General, m_Name, StdString(L"The V8 runtime is thread-affine and cannot be accessed from the current thread"), false /*executionStarted*/);
+}
+
+//-----------------------------------------------------------------------------
+
+V8IsolateImpl::~V8IsolateImpl()
+{
+    --s_InstanceCount;
+    m_Released = true;
+
+    if (m_ThreadAffine && !IsOwnerThread())
+    {
+        // Only the owner thread can release its hold on the isolate. Elsewhere (typically on the
+        // finalizer thread) the instance is torn down without disposing the V8 isolate, whose
+        // resources are leaked.
+
+        V8Platform::GetInstance().GetTimerWheel().CancelGroup(this);
+        IGNORE_UNUSED(m_spInspectorSession.release());
+        IGNORE_UNUSED(m_spInspector.release());
+        IGNORE_UNUSED(m_spOwnerLocker.release());
+        IGNORE_UNUSED(m_spArrayBufferAllocator.release());
+        return;
+    }
+
+    // Entering the isolate scope triggers call-with-lock queue processing. It should always be
+    // done here, if for no other reason than that it may prevent deadlocks in V8 isolate disposal.
+
+    BEGIN_ISOLATE_SCOPE
+        DisableDebugging();
+    END_ISOLATE_SCOPE
+
+    V8Platform::GetInstance().GetTimerWheel().CancelGroup(this);
+
+    {
+        std::unordered_set<std::shared_ptr<v8::Task>> asyncTasks;
+
+        BEGIN_MUTEX_SCOPE(m_DataMutex)
+            std::swap(asyncTasks, m_AsyncTasks);
+        END_MUTEX_SCOPE
+
+        for (const auto& spTask : asyncTasks)
+        {
+            spTask->Run();
+        }
+    }
+
+    {
+        // unlike async tasks, idle tasks are optional; discard them before isolate disposal
+
+        std::deque<std::unique_ptr<v8::IdleTask>> idleTasks;
+
+        BEGIN_MUTEX_SCOPE(m_DataMutex)
+            std::swap(idleTasks, m_IdleTasks);
+        END_MUTEX_SCOPE
+    }
+
+    for (auto& pair : m_SharedScripts)
+    {
+        Dispose(pair.second.hScript);
+    }
+
+    m_SharedScripts.clear();
+
+    std::vector<ExternalArrayBuffer*> externalArrayBuffers(m_ExternalArrayBuffers.begin(), m_ExternalArrayBuffers.end());
+    for (auto pExternalArrayBuffer : externalArrayBuffers)
+    {
+        ClearWeak(pExternalArrayBuffer->hArrayBuffer);
+        Dispose(pExternalArrayBuffer->hArrayBuffer);
+    }
+
+    m_ExternalArrayBuffers.clear();
+    m_SharedArrayBuffers.clear();
+    Dispose(m_hHostObjectHolderKey);
+
+    m_pIsolate->RemoveNearHeapLimitCallback(OnNearHeapLimit, 0);
+    m_pIsolate->RemoveGCEpilogueCallback(OnGCEpilogue, this);
+    m_pIsolate->RemoveGCPrologueCallback(OnGCPrologue, this);
+    m_pIsolate->RemoveBeforeCallEnteredCallback(OnBeforeCallEntered);
+
+    if (m_ThreadAffine)
+    {
+        m_pIsolate->Exit();
+        m_spOwnerLocker.reset();
+    }
+
+    m_pIsolate->Dispose();
+
+    // external ArrayBuffer memory must outlive the isolate; release it only after disposal
+
+    for (auto pExternalArrayBuffer : externalArrayBuffers)
+    {
+        if (pExternalArrayBuffer->ReleaseCallback)
+        {
+            HostObjectHelpers::QueueNativeCallback(std::move(pExternalArrayBuffer->ReleaseCallback));
+        }
+
+        delete pExternalArrayBuffer;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::WaitForMutex()
+{
+    // With time slicing enabled, a thread that finds the isolate busy asks the current holder
+    // to yield once the time slice has elapsed. The request is an interrupt, so it's honored
+    // at the holder's next interrupt check, even in the middle of a long-running script.
+
+    BEGIN_MUTEX_SCOPE(m_HandoffMutex)
+        ++m_MutexWaiterCount;
+    END_MUTEX_SCOPE
+
+    V8TimerWheel::TimerId timerId = 0;
+    double timeSliceInterval = m_TimeSliceInterval;
+    if (timeSliceInterval > 0)
+    {
+        auto wrIsolate = CreateWeakRef();
+        timerId = V8Platform::GetInstance().GetTimerWheel().Schedule(this, timeSliceInterval / 1000, [this, wrIsolate] (V8TimerWheel::TimerId /*timerId*/)
+        {
+            auto spIsolate = wrIsolate.GetTarget();
+            if (!spIsolate.IsEmpty())
+            {
+                RequestInterrupt(OnTimeSliceExpired, this);
             }
-        }));
+        });
+    }
 
-        // hold on to the timer to ensure callback execution
+    m_Mutex.Lock();
 
-        BEGIN_MUTEX_SCOPE(m_DataMutex)
-            m_TaskTimers.push_back(spTimer);
-        END_MUTEX_SCOPE
+    if (timerId != 0)
+    {
+        V8Platform::GetInstance().GetTimerWheel().Cancel(timerId);
+    }
 
-        // Release the local task reference explicitly. Doing so avoids a deadlock if the callback is
-        // executed synchronously. That shouldn't happen given the current timer implementation.
+    BEGIN_MUTEX_SCOPE(m_HandoffMutex)
+        --m_MutexWaiterCount;
+        ++m_MutexHandoffCount;
+    END_MUTEX_SCOPE
 
-        spTask.reset();
+    m_HandoffChanged.notify_all();
+}
 
-        // now it's safe to start the timer
+//-----------------------------------------------------------------------------
 
-        spTimer->Start();
-    }
+void V8IsolateImpl::WaitForHandoff(std::uint64_t handoffCount)
+{
+    std::unique_lock<std::mutex> lock(m_HandoffMutex.GetImpl());
+    m_HandoffChanged.wait(lock, [this, handoffCount]
+    {
+        return (m_MutexWaiterCount < 1) || (m_MutexHandoffCount != handoffCount);
+    });
 }
 
 //-----------------------------------------------------------------------------
 
-std::shared_ptr<v8::TaskRunner> V8IsolateImpl::GetForegroundTaskRunner()
+void V8IsolateImpl::OnMutexLocked()
 {
-    BEGIN_MUTEX_SCOPE(m_DataMutex)
+    // a time slice spans consecutive calls on the same thread; it restarts when another thread
+    // takes over
 
-        if (!m_spForegroundTaskRunner)
+    if (m_MutexLockDepth++ < 1)
+    {
+        auto threadId = std::this_thread::get_id();
+        if (threadId != m_TimeSliceThreadId)
         {
-            m_spForegroundTaskRunner = std::make_shared<V8ForegroundTaskRunner>(this);
+            m_TimeSliceThreadId = threadId;
+            m_TimeSliceStartTime = HighResolutionClock::GetRelativeSeconds();
         }
-
-        return m_spForegroundTaskRunner;
-
-    END_MUTEX_SCOPE
+    }
 }
 
 //-----------------------------------------------------------------------------
 
-void V8IsolateImpl::CallWithLockNoWait(std::function<void(V8IsolateImpl*)>&& callback)
+void V8IsolateImpl::UnlockMutex()
 {
-    if (m_Mutex.TryLock())
+    _ASSERTE(m_MutexLockDepth > 0);
+
+    if (--m_MutexLockDepth > 0)
     {
-        // the callback may release this instance; hold it for destruction outside isolate scope
-        SharedPtr<V8IsolateImpl> spThis(this);
+        m_Mutex.Unlock();
+        return;
+    }
 
-        MutexLock<RecursiveMutex> lock(m_Mutex, false);
-        BEGIN_ISOLATE_NATIVE_SCOPE
-            callback(this);
-        END_ISOLATE_NATIVE_SCOPE
+    // A thread that releases its outermost lock after its time slice has elapsed waits for a
+    // waiting thread to take the mutex; otherwise it would likely reacquire it right away.
+
+    auto yield = false;
+    std::uint64_t handoffCount = 0;
+
+    double timeSliceInterval = m_TimeSliceInterval;
+    if ((timeSliceInterval > 0) && ((HighResolutionClock::GetRelativeSeconds() - m_TimeSliceStartTime) * 1000 >= timeSliceInterval))
+    {
+        BEGIN_MUTEX_SCOPE(m_HandoffMutex)
+            yield = m_MutexWaiterCount > 0;
+            handoffCount = m_MutexHandoffCount;
+        END_MUTEX_SCOPE
     }
-    else
+
+    m_Mutex.Unlock();
+
+    if (yield)
     {
-        CallWithLockAsync(std::move(callback));
+        WaitForHandoff(handoffCount);
     }
 }
 
 //-----------------------------------------------------------------------------
 
-void DECLSPEC_NORETURN V8IsolateImpl::ThrowOutOfMemoryException()
+void V8IsolateImpl::OnTimeSliceExpired(v8::Isolate* /*pIsolate*/, void* pvIsolateImpl)
 {
-    m_IsOutOfMemory = true;
-    throw V8Exception(V8Exception::Type::Fatal, m_Name, StdString(L"The V8 runtime has exceeded its memory limit"), (m_pExecutionScope != nullptr) ? m_pExecutionScope->ExecutionStarted() : false);
+    static_cast<V8IsolateImpl*>(pvIsolateImpl)->YieldToWaiters();
 }
 
 //-----------------------------------------------------------------------------
 
-V8IsolateImpl::~V8IsolateImpl()
+void V8IsolateImpl::YieldToWaiters()
 {
-    --s_InstanceCount;
-    m_Released = true;
+    _ASSERTE(IsCurrent() && IsLocked());
 
-    // Entering the isolate scope triggers call-with-lock queue processing. It should always be
-    // done here, if for no other reason than that it may prevent deadlocks in V8 isolate disposal.
+    // V8 runs interrupts only between script operations, never within a host callback, so this
+    // is a safe point at which to give up the isolate. The debugger's message loop isn't.
 
-    BEGIN_ISOLATE_SCOPE
-        DisableDebugging();
-    END_ISOLATE_SCOPE
+    if (m_ThreadAffine || (m_MutexLockDepth < 1) || m_InMessageLoop)
+    {
+        return;
+    }
+
+    std::uint64_t handoffCount = 0;
+    BEGIN_MUTEX_SCOPE(m_HandoffMutex)
+        if (m_MutexWaiterCount < 1)
+        {
+            return;
+        }
+
+        handoffCount = m_MutexHandoffCount;
+    END_MUTEX_SCOPE
+
+    // The execution scope, stack usage monitoring state, and the invocation state of the script
+    // engines this thread is running belong to this thread's script frames. They're set aside so
+    // that another thread entering the same engines starts clean and can't clobber them. V8
+    // archives its own per-thread state (including the stack limit) when the lock is released.
+
+    auto mutexLockDepth = m_MutexLockDepth;
+    auto pExecutionScope = m_pExecutionScope;
+    auto stackWatchLevel = m_StackWatchLevel;
+    auto pStackLimit = m_pStackLimit;
+    auto pvInvocationState = HostObjectHelpers::SuspendScriptInvocations();
+
+    m_pExecutionScope = nullptr;
+    m_StackWatchLevel = 0;
+    m_pStackLimit = nullptr;
 
     {
-        std::vector<std::shared_ptr<v8::Task>> asyncTasks;
-        std::vector<SharedPtr<Timer>> taskTimers;
+        v8::Unlocker unlocker(m_pIsolate);
 
-        BEGIN_MUTEX_SCOPE(m_DataMutex)
-            std::swap(asyncTasks, m_AsyncTasks);
-            std::swap(taskTimers, m_TaskTimers);
-        END_MUTEX_SCOPE
+        m_MutexLockDepth = 0;
+        for (size_t index = 0; index < mutexLockDepth; index++)
+        {
+            m_Mutex.Unlock();
+        }
 
-        for (const auto& spTask : asyncTasks)
+        WaitForHandoff(handoffCount);
+
+        // rejoin as a waiter so that the new holder yields in turn once its time slice elapses
+        if (!m_Mutex.TryLock())
         {
-            spTask->Run();
+            WaitForMutex();
         }
-    }
 
-    Dispose(m_hHostObjectHolderKey);
+        OnMutexLocked();
+        for (size_t index = 1; index < mutexLockDepth; index++)
+        {
+            m_Mutex.Lock();
+        }
 
-    m_pIsolate->RemoveBeforeCallEnteredCallback(OnBeforeCallEntered);
-    m_pIsolate->Dispose();
+        m_MutexLockDepth = mutexLockDepth;
+    }
+
+    m_pExecutionScope = pExecutionScope;
+    m_StackWatchLevel = stackWatchLevel;
+    m_pStackLimit = pStackLimit;
+    HostObjectHelpers::ResumeScriptInvocations(pvInvocationState);
 }
 
 //-----------------------------------------------------------------------------
@@ -995,7 +1718,13 @@ bool V8IsolateImpl::RunMessageLoop(bool awaitingDebugger)
         m_AbortMessageLoop = false;
 
         BEGIN_PULSE_VALUE_SCOPE(&m_AwaitingDebugger, awaitingDebugger)
-        BEGIN_PULSE_VALUE_SCOPE(&m_InMessageLoop, true)
+
+            // Producers read this flag without the data mutex; it can't use a pulse value scope.
+            // The fence pairs with the one in CallWithLockAsync: either the producer sees the flag
+            // and notifies, or the queue check below sees the producer's callback.
+
+            m_InMessageLoop = true;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
 
             ProcessCallWithLockQueue(lock);
 
@@ -1010,7 +1739,12 @@ bool V8IsolateImpl::RunMessageLoop(bool awaitingDebugger)
                 }
             }
 
-        END_PULSE_VALUE_SCOPE
+            // from here on, producers request an interrupt; the final queue check below is
+            // fenced for the same reason as the one above
+
+            m_InMessageLoop = false;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
         END_PULSE_VALUE_SCOPE
 
         ProcessCallWithLockQueue(lock);
@@ -1022,28 +1756,26 @@ bool V8IsolateImpl::RunMessageLoop(bool awaitingDebugger)
 
 //-----------------------------------------------------------------------------
 
-void V8IsolateImpl::CallWithLockAsync(std::function<void(V8IsolateImpl*)>&& callback)
+void V8IsolateImpl::CallWithLockAsync(V8CallWithLockQueue::Callback&& callback)
 {
     if (callback)
     {
-        auto requestInterrupt = false;
+        m_CallWithLockQueue.Enqueue(std::move(callback));
 
-        BEGIN_MUTEX_SCOPE(m_DataMutex)
+        // The queue publishes callbacks with release semantics only. Without a full fence, this
+        // flag load could complete before the enqueue becomes visible, and the message loop's
+        // queue check could miss the callback while this thread misses the flag.
 
-            m_CallWithLockQueue.push(std::move(callback));
+        std::atomic_thread_fence(std::memory_order_seq_cst);
 
-            if (m_InMessageLoop)
-            {
+        if (m_InMessageLoop)
+        {
+            // acquire the data mutex to ensure that the message loop doesn't miss the notification
+            BEGIN_MUTEX_SCOPE(m_DataMutex)
                 m_CallWithLockQueueChanged.notify_one();
-            }
-            else
-            {
-                requestInterrupt = m_CallWithLockQueue.size() == 1;
-            }
-
-        END_MUTEX_SCOPE
-
-        if (requestInterrupt)
+            END_MUTEX_SCOPE
+        }
+        else if (!m_CallWithLockInterruptPending.exchange(true))
         {
             RequestInterrupt(ProcessCallWithLockQueue, this);
         }
@@ -1061,13 +1793,26 @@ void V8IsolateImpl::ProcessCallWithLockQueue(v8::Isolate* /*pIsolate*/, void* pv
 
 void V8IsolateImpl::ProcessCallWithLockQueue()
 {
-    std::queue<std::function<void(V8IsolateImpl*)>> callWithLockQueue;
+    _ASSERTE(IsCurrent() && IsLocked());
 
-    BEGIN_MUTEX_SCOPE(m_DataMutex)
-        std::swap(callWithLockQueue, m_CallWithLockQueue);
-    END_MUTEX_SCOPE
+    // clear the interrupt flag first; callbacks enqueued from here on request a new interrupt,
+    // and the fence keeps the queue check below from overtaking the store
+    m_CallWithLockInterruptPending = false;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    V8CallWithLockQueue::Callback callback;
+    while (m_CallWithLockQueue.TryDequeue(callback))
+    {
+        try
+        {
+            callback(this);
+        }
+        catch (...)
+        {
+        }
 
-    ProcessCallWithLockQueue(callWithLockQueue);
+        callback.Reset();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -1076,32 +1821,27 @@ void V8IsolateImpl::ProcessCallWithLockQueue(std::unique_lock<std::mutex>& lock)
 {
     _ASSERTE(lock.owns_lock());
 
-    std::queue<std::function<void(V8IsolateImpl*)>> callWithLockQueue(std::move(m_CallWithLockQueue));
-    while (callWithLockQueue.size() > 0)
+    // Producers notify the message loop under the data mutex after enqueuing, so checking for
+    // callbacks under the mutex before waiting can't miss one.
+
+    while (!m_CallWithLockQueue.IsEmpty())
     {
         lock.unlock();
-        ProcessCallWithLockQueue(callWithLockQueue);
+        ProcessCallWithLockQueue();
         lock.lock();
-        callWithLockQueue = std::move(m_CallWithLockQueue);
     }
 }
 
-
 //-----------------------------------------------------------------------------
 
-void V8IsolateImpl::ProcessCallWithLockQueue(std::queue<std::function<void(V8IsolateImpl*)>>& callWithLockQueue)
+void V8IsolateImpl::ProcessCallWithLockQueueIfNecessary()
 {
-    while (callWithLockQueue.size() > 0)
-    {
-        try
-        {
-            callWithLockQueue.front()(this);
-        }
-        catch (...)
-        {
-        }
+    // An empty queue is detected without a write; this keeps the fast path of every isolate
+    // scope free of atomic read-modify-write operations and fences.
 
-        callWithLockQueue.pop();
+    if (!m_CallWithLockQueue.IsEmpty())
+    {
+        ProcessCallWithLockQueue();
     }
 }
 
@@ -1150,15 +1890,15 @@ V8IsolateImpl::ExecutionScope* V8IsolateImpl::EnterExecutionScope(ExecutionScope
     // is heap size monitoring in progress?
     if (m_HeapWatchLevel == 0)
     {
-        // no; there should be no heap watch timer
-        _ASSERTE(m_spHeapWatchTimer.IsEmpty());
-
         // is a heap size limit specified?
         size_t maxHeapSize = m_MaxHeapSize;
         if (maxHeapSize > 0)
         {
-            // yes; perform initial check and set up heap watch timer
-            CheckHeapSize(maxHeapSize);
+            // yes; perform initial check; garbage collections trigger subsequent checks
+            if (GetMonitoredHeapSize() > maxHeapSize)
+            {
+                CheckHeapSize(maxHeapSize);
+            }
 
             // enter outermost heap size monitoring scope
             m_HeapWatchLevel = 1;
@@ -1258,74 +1998,233 @@ void V8IsolateImpl::ExitExecutionScope(ExecutionScope* pPreviousExecutionScope)
     if (m_HeapWatchLevel > 0)
     {
         // yes; exit heap size monitoring scope
-        if (--m_HeapWatchLevel == 0)
-        {
-            // exited outermost scope; destroy heap watch timer
-            m_spHeapWatchTimer.Empty();
-        }
+        --m_HeapWatchLevel;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+size_t V8IsolateImpl::GetMonitoredHeapSize()
+{
+    // the monitored heap size includes ArrayBuffer memory
+
+    v8::HeapStatistics heapStatistics;
+    m_pIsolate->GetHeapStatistics(&heapStatistics);
+    return heapStatistics.total_heap_size() + m_spArrayBufferAllocator->GetSize();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::CheckHeapSize(size_t maxHeapSize)
+{
+    _ASSERTE(IsCurrent() && IsLocked());
+
+    // the heap size is over the limit; collect garbage and check again
+
+    m_HeapSizeCheckTime = V8Platform::GetInstance().MonotonicallyIncreasingTime();
+    LowMemoryNotification();
+
+    if (GetMonitoredHeapSize() > maxHeapSize)
+    {
+        // the isolate is out of memory; request script termination
+        m_IsOutOfMemory = true;
+        TerminateExecution();
     }
 }
 
 //-----------------------------------------------------------------------------
 
-void V8IsolateImpl::SetUpHeapWatchTimer(size_t maxHeapSize)
+void V8IsolateImpl::CaptureHeapInfo(V8IsolateHeapInfo& heapInfo)
 {
     _ASSERTE(IsCurrent() && IsLocked());
 
-    // create heap watch timer
-    auto wrIsolate = CreateWeakRef();
-    m_spHeapWatchTimer = new Timer(static_cast<int>(std::max(GetHeapSizeSampleInterval(), 250.0)), -1, [this, wrIsolate, maxHeapSize] (Timer* pTimer)
+    v8::HeapStatistics heapStatistics;
+    m_pIsolate->GetHeapStatistics(&heapStatistics);
+
+    heapInfo.Set(
+        heapStatistics.total_heap_size(),
+        heapStatistics.total_heap_size_executable(),
+        heapStatistics.total_physical_size(),
+        heapStatistics.used_heap_size(),
+        heapStatistics.heap_size_limit()
+    );
+
+    heapInfo.SetArrayBufferInfo(
+        m_spArrayBufferAllocator->GetSize(),
+        m_spArrayBufferAllocator->GetPeakSize(),
+        m_spArrayBufferAllocator->GetCount()
+    );
+
+    // a zero adjustment reports the current amount of external memory
+    auto externalMemory = m_pIsolate->AdjustAmountOfExternalAllocatedMemory(0);
+
+    heapInfo.SetExtendedInfo(
+        heapStatistics.total_available_size(),
+        heapStatistics.malloced_memory(),
+        heapStatistics.peak_malloced_memory(),
+        static_cast<size_t>(std::max(externalMemory, static_cast<int64_t>(0))),
+        heapStatistics.number_of_native_contexts(),
+        heapStatistics.number_of_detached_contexts()
+    );
+
+    auto& spaceInfo = heapInfo.GetSpaceInfo();
+    auto spaceCount = m_pIsolate->NumberOfHeapSpaces();
+    spaceInfo.resize(spaceCount);
+
+    for (size_t index = 0; index < spaceCount; index++)
     {
-        // heap watch callback; is the isolate still alive?
-        auto spIsolate = wrIsolate.GetTarget();
-        if (!spIsolate.IsEmpty())
+        v8::HeapSpaceStatistics spaceStatistics;
+        if (m_pIsolate->GetHeapSpaceStatistics(&spaceStatistics, index))
         {
-            // yes; request callback on execution thread
-            auto wrTimer = pTimer->CreateWeakRef();
-            CallWithLockAsync([wrTimer, maxHeapSize] (V8IsolateImpl* pIsolateImpl)
-            {
-                // execution thread callback; is the timer still alive?
-                auto spTimer = wrTimer.GetTarget();
-                if (!spTimer.IsEmpty())
-                {
-                    // yes; check heap size
-                    pIsolateImpl->CheckHeapSize(maxHeapSize);
-                }
-            });
+            spaceInfo[index].Set(
+                spaceStatistics.space_name(),
+                spaceStatistics.space_size(),
+                spaceStatistics.space_used_size(),
+                spaceStatistics.space_available_size(),
+                spaceStatistics.physical_space_size()
+            );
         }
-    });
+    }
 
-    // start heap watch timer
-    m_spHeapWatchTimer->Start();
+    // bytes allocated since the last collection are those now in use beyond its survivors
+    auto usedHeapSize = heapStatistics.used_heap_size();
+    auto allocatedSize = m_HeapAllocatedSize + ((usedHeapSize > m_HeapUsedSizeAfterGC) ? (usedHeapSize - m_HeapUsedSizeAfterGC) : 0);
+    heapInfo.SetAllocationInfo(V8Platform::GetInstance().MonotonicallyIncreasingTime(), allocatedSize);
+
+    BEGIN_MUTEX_SCOPE(m_HeapInfoMutex)
+        m_HeapInfoSnapshot = heapInfo;
+    END_MUTEX_SCOPE
 }
 
 //-----------------------------------------------------------------------------
 
-void V8IsolateImpl::CheckHeapSize(size_t maxHeapSize)
+void V8IsolateImpl::SetAllocationRate(V8IsolateHeapInfo& heapInfo, AllocationSample& sample)
 {
-    _ASSERTE(IsCurrent() && IsLocked());
+    // Full retrievals and snapshot reads keep separate samples, so polling one doesn't shorten
+    // the interval seen by the other. Repeated reads of the same snapshot report the rate last
+    // computed.
 
-    // is the total heap size over the limit?
-    V8IsolateHeapInfo heapInfo;
-    GetHeapInfo(heapInfo);
-    if (heapInfo.GetTotalHeapSize() > maxHeapSize)
+    auto elapsed = heapInfo.GetSampleTime() - sample.Time;
+    if (elapsed > 0)
     {
-        // yes; collect garbage
-        LowMemoryNotification();
+        auto allocatedSize = heapInfo.GetTotalAllocatedSize();
+        sample.Rate = (allocatedSize > sample.Size) ? ((allocatedSize - sample.Size) / elapsed) : 0;
+        sample.Time = heapInfo.GetSampleTime();
+        sample.Size = allocatedSize;
+    }
 
-        // is the total heap size still over the limit?
-        GetHeapInfo(heapInfo);
-        if (heapInfo.GetTotalHeapSize() > maxHeapSize)
-        {
-            // yes; the isolate is out of memory; request script termination
-            m_IsOutOfMemory = true;
-            TerminateExecution();
-            return;
-        }
+    heapInfo.SetAllocationRate(sample.Rate);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::OnGCPrologue(v8::Isolate* /*pIsolate*/, v8::GCType /*type*/, v8::GCCallbackFlags /*flags*/, void* pvIsolateImpl)
+{
+    static_cast<V8IsolateImpl*>(pvIsolateImpl)->OnGCPrologue();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::OnGCPrologue()
+{
+    // account for the bytes allocated since the previous collection before this one frees any
+
+    v8::HeapStatistics heapStatistics;
+    m_pIsolate->GetHeapStatistics(&heapStatistics);
+
+    auto usedHeapSize = heapStatistics.used_heap_size();
+    if (usedHeapSize > m_HeapUsedSizeAfterGC)
+    {
+        m_HeapAllocatedSize += usedHeapSize - m_HeapUsedSizeAfterGC;
+    }
+
+    m_HeapUsedSizeAfterGC = usedHeapSize;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::OnGCEpilogue(v8::Isolate* /*pIsolate*/, v8::GCType type, v8::GCCallbackFlags /*flags*/, void* pvIsolateImpl)
+{
+    static_cast<V8IsolateImpl*>(pvIsolateImpl)->OnGCEpilogue(type);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::OnGCEpilogue(v8::GCType type)
+{
+    // Every collection records the surviving heap size for allocation tracking. Capturing full
+    // heap info walks every heap space, so only full collections refresh the snapshot.
+
+    if ((type & v8::kGCTypeMarkSweepCompact) != 0)
+    {
+        V8IsolateHeapInfo heapInfo;
+        CaptureHeapInfo(heapInfo);
+    }
+
+    v8::HeapStatistics heapStatistics;
+    m_pIsolate->GetHeapStatistics(&heapStatistics);
+    m_HeapUsedSizeAfterGC = heapStatistics.used_heap_size();
+
+    // Heap growth is also observed here, right after each collection, rather than by sampling.
+    // A collection can't be started from within a GC callback, so confirmation is deferred to an
+    // interrupt. The sample interval limits how often confirmation can force a full collection.
+
+    if ((m_HeapWatchLevel < 1) || m_HeapSizeCheckPending || m_IsOutOfMemory)
+    {
+        return;
+    }
+
+    size_t maxHeapSize = m_MaxHeapSize;
+    if ((maxHeapSize < 1) || ((heapStatistics.total_heap_size() + m_spArrayBufferAllocator->GetSize()) <= maxHeapSize))
+    {
+        return;
+    }
+
+    if ((V8Platform::GetInstance().MonotonicallyIncreasingTime() - m_HeapSizeCheckTime) < (GetHeapSizeSampleInterval() / 1000))
+    {
+        return;
+    }
+
+    m_HeapSizeCheckPending = true;
+    RequestInterrupt(OnHeapSizeCheckRequested, this);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::OnHeapSizeCheckRequested(v8::Isolate* /*pIsolate*/, void* pvIsolateImpl)
+{
+    auto pIsolateImpl = static_cast<V8IsolateImpl*>(pvIsolateImpl);
+    pIsolateImpl->m_HeapSizeCheckPending = false;
+
+    size_t maxHeapSize = pIsolateImpl->m_MaxHeapSize;
+    if ((pIsolateImpl->m_HeapWatchLevel > 0) && (maxHeapSize > 0) && (pIsolateImpl->GetMonitoredHeapSize() > maxHeapSize))
+    {
+        pIsolateImpl->CheckHeapSize(maxHeapSize);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+size_t V8IsolateImpl::OnNearHeapLimit(void* pvIsolateImpl, size_t currentHeapLimit, size_t initialHeapLimit)
+{
+    return static_cast<V8IsolateImpl*>(pvIsolateImpl)->OnNearHeapLimit(currentHeapLimit, initialHeapLimit);
+}
+
+//-----------------------------------------------------------------------------
+
+size_t V8IsolateImpl::OnNearHeapLimit(size_t currentHeapLimit, size_t initialHeapLimit)
+{
+    // V8 is about to exceed its hard heap limit, which would terminate the process. If script
+    // code is running, terminate it instead, and raise the limit enough for it to unwind.
+
+    if (m_pExecutionScope == nullptr)
+    {
+        return currentHeapLimit;
     }
 
-    // the isolate is not out of memory; restart heap watch timer
-    SetUpHeapWatchTimer(maxHeapSize);
+    m_IsOutOfMemory = true;
+    TerminateExecution();
+    return currentHeapLimit + (initialHeapLimit / 4);
 }
 
 //-----------------------------------------------------------------------------
@@ -1346,3 +2245,37 @@ void V8IsolateImpl::OnBeforeCallEntered()
         m_pExecutionScope->OnExecutionStarted();
     }
 }
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::AddExternalArrayBuffer(v8::Local<v8::Object> hArrayBuffer, HostObjectHelpers::NativeCallback&& releaseCallback, const SharedPtr<V8SharedArrayBufferStore>& spSharedArrayBufferStore)
+{
+    auto pExternalArrayBuffer = new ExternalArrayBuffer { std::move(releaseCallback), spSharedArrayBufferStore, Persistent<v8::Object>() };
+    pExternalArrayBuffer->hArrayBuffer = MakeWeak(CreatePersistent(hArrayBuffer), this, pExternalArrayBuffer, OnExternalArrayBufferCollected);
+    m_ExternalArrayBuffers.insert(pExternalArrayBuffer);
+
+    if (!spSharedArrayBufferStore.IsEmpty())
+    {
+        m_SharedArrayBuffers[spSharedArrayBufferStore->GetData()] = pExternalArrayBuffer;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8IsolateImpl::OnExternalArrayBufferCollected(v8::Isolate* /*pIsolate*/, Persistent<v8::Object>* phArrayBuffer, V8IsolateImpl* pIsolateImpl, ExternalArrayBuffer* pExternalArrayBuffer)
+{
+    pIsolateImpl->m_ExternalArrayBuffers.erase(pExternalArrayBuffer);
+    if (!pExternalArrayBuffer->spSharedArrayBufferStore.IsEmpty())
+    {
+        pIsolateImpl->m_SharedArrayBuffers.erase(pExternalArrayBuffer->spSharedArrayBufferStore->GetData());
+    }
+
+    phArrayBuffer->Dispose();
+
+    if (pExternalArrayBuffer->ReleaseCallback)
+    {
+        HostObjectHelpers::QueueNativeCallback(std::move(pExternalArrayBuffer->ReleaseCallback));
+    }
+
+    delete pExternalArrayBuffer;
+}
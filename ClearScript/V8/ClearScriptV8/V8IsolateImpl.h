@@ -17,6 +17,37 @@ class V8IsolateImpl: public V8Isolate, public v8_inspector::V8InspectorClient, p
 {
     PROHIBIT_COPY(V8IsolateImpl)
 
+    class LockerScope
+    {
+        PROHIBIT_COPY(LockerScope)
+        PROHIBIT_HEAP(LockerScope)
+
+    public:
+
+        // the owner thread of a thread-affine isolate holds the V8 lock permanently
+        explicit LockerScope(V8IsolateImpl* pIsolateImpl):
+            m_Locked(!pIsolateImpl->m_ThreadAffine)
+        {
+            if (m_Locked)
+            {
+                new (&m_LockerStorage) v8::Locker(pIsolateImpl->m_pIsolate);
+            }
+        }
+
+        ~LockerScope()
+        {
+            if (m_Locked)
+            {
+                reinterpret_cast<v8::Locker*>(&m_LockerStorage)->~Locker();
+            }
+        }
+
+    private:
+
+        bool m_Locked;
+        std::aligned_storage<sizeof(v8::Locker), alignof(v8::Locker)>::type m_LockerStorage;
+    };
+
     class NativeScope
     {
         PROHIBIT_COPY(NativeScope)
@@ -26,26 +57,69 @@ class V8IsolateImpl: public V8Isolate, public v8_inspector::V8InspectorClient, p
 
         explicit NativeScope(V8IsolateImpl* pIsolateImpl):
             m_pIsolateImpl(pIsolateImpl),
-            m_LockScope(m_pIsolateImpl->m_pIsolate),
+            m_LockScope(m_pIsolateImpl),
             m_IsolateScope(m_pIsolateImpl->m_pIsolate),
             m_HandleScope(m_pIsolateImpl->m_pIsolate)
         {
-            m_pIsolateImpl->ProcessCallWithLockQueue();
+            m_pIsolateImpl->ProcessCallWithLockQueueIfNecessary();
         }
 
         ~NativeScope()
         {
-            m_pIsolateImpl->ProcessCallWithLockQueue();
+            m_pIsolateImpl->ProcessCallWithLockQueueIfNecessary();
         }
 
     private:
 
         V8IsolateImpl* m_pIsolateImpl;
-        v8::Locker m_LockScope;
+        LockerScope m_LockScope;
         v8::Isolate::Scope m_IsolateScope;
         v8::HandleScope m_HandleScope;
     };
 
+    class MutexScope
+    {
+        PROHIBIT_COPY(MutexScope)
+        PROHIBIT_HEAP(MutexScope)
+
+    public:
+
+        // a thread-affine isolate rejects other threads instead of serializing them
+        explicit MutexScope(V8IsolateImpl* pIsolateImpl):
+            m_pIsolateImpl(pIsolateImpl),
+            m_Locked(!pIsolateImpl->m_ThreadAffine)
+        {
+            if (m_Locked)
+            {
+                m_pIsolateImpl->LockMutex();
+            }
+            else if (!m_pIsolateImpl->IsOwnerThread())
+            {
+                m_pIsolateImpl->ThrowThreadAffinityException();
+            }
+        }
+
+        // adopts a lock acquired via TryLockMutex
+        MutexScope(V8IsolateImpl* pIsolateImpl, bool locked):
+            m_pIsolateImpl(pIsolateImpl),
+            m_Locked(locked)
+        {
+        }
+
+        ~MutexScope()
+        {
+            if (m_Locked)
+            {
+                m_pIsolateImpl->UnlockMutex();
+            }
+        }
+
+    private:
+
+        V8IsolateImpl* m_pIsolateImpl;
+        bool m_Locked;
+    };
+
 public:
 
     class Scope
@@ -56,14 +130,14 @@ public:
     public:
 
         explicit Scope(V8IsolateImpl* pIsolateImpl):
-            m_MutexLock(pIsolateImpl->m_Mutex),
+            m_MutexScope(pIsolateImpl),
             m_NativeScope(pIsolateImpl)
         {
         }
 
     private:
 
-        MutexLock<RecursiveMutex> m_MutexLock;
+        MutexScope m_MutexScope;
         NativeScope m_NativeScope;
     };
 
@@ -120,6 +194,9 @@ public:
 
 	static V8IsolateImpl* GetInstanceFromIsolate(v8::Isolate* pIsolate);
     static size_t GetInstanceCount();
+    static void GetWorkerPoolStatistics(WorkerPoolStatistics& statistics);
+    static void GetIdleTaskCounts(std::uint64_t& postedCount, std::uint64_t& runCount);
+    static V8SnapshotBlob* CreateSnapshotBlob(const StdString& name, const StdString& warmUpCode);
 
     const StdString& GetName() const { return m_Name; }
     const Persistent<v8::Private>& GetHostObjectHolderKey() const { return m_hHostObjectHolderKey; }
@@ -179,6 +256,31 @@ public:
         return value.ToV8String(m_pIsolate);
     }
 
+    v8::MaybeLocal<v8::String> CreateString(const wchar_t* pValue, int length)
+    {
+        return StdString::ToV8String(m_pIsolate, pValue, length);
+    }
+
+    int WriteString(v8::Local<v8::String> hString, wchar_t* pBuffer, int length)
+    {
+        return hString->Write(m_pIsolate, reinterpret_cast<uint16_t*>(pBuffer), 0, length, v8::String::NO_NULL_TERMINATION);
+    }
+
+    v8::MaybeLocal<v8::String> CreateStringFromUtf8(const char* pValue, int length)
+    {
+        return v8::String::NewFromUtf8(m_pIsolate, pValue, v8::NewStringType::kNormal, length);
+    }
+
+    int GetUtf8Length(v8::Local<v8::String> hString)
+    {
+        return hString->Utf8Length(m_pIsolate);
+    }
+
+    int WriteUtf8(v8::Local<v8::String> hString, char* pBuffer, int size)
+    {
+        return hString->WriteUtf8(m_pIsolate, pBuffer, size, nullptr, v8::String::NO_NULL_TERMINATION);
+    }
+
     StdString CreateStdString(v8::Local<v8::Value> hValue)
     {
         return StdString(m_pIsolate, hValue);
@@ -219,6 +321,11 @@ public:
         return v8::ScriptCompiler::CompileUnboundScript(m_pIsolate, pSource, options);
     }
 
+    v8::ScriptCompiler::ScriptStreamingTask* StartStreamingScript(v8::ScriptCompiler::StreamedSource* pSource)
+    {
+        return v8::ScriptCompiler::StartStreamingScript(m_pIsolate, pSource);
+    }
+
     template <typename T>
     v8::Local<T> CreateLocal(v8::Local<T> hTarget)
     {
@@ -271,6 +378,16 @@ public:
         return m_DebuggingEnabled;
     }
 
+    bool IsThreadAffine() const
+    {
+        return m_ThreadAffine;
+    }
+
+    bool IsOwnerThread() const
+    {
+        return std::this_thread::get_id() == m_OwnerThreadId;
+    }
+
     void TerminateExecution()
     {
         BEGIN_MUTEX_SCOPE(m_DataMutex)
@@ -312,6 +429,7 @@ public:
     void LowMemoryNotification()
     {
         m_pIsolate->LowMemoryNotification();
+        V8ArrayBufferAllocator::Trim();
     }
 
 	v8::Local<v8::StackFrame> GetStackFrame(v8::Local<v8::StackTrace> hStackTrace, uint32_t index)
@@ -354,6 +472,8 @@ public:
     virtual void SetMaxHeapSize(size_t value) override;
     virtual double GetHeapSizeSampleInterval() override;
     virtual void SetHeapSizeSampleInterval(double value) override;
+    virtual double GetTimeSliceInterval() override;
+    virtual void SetTimeSliceInterval(double value) override;
 
     virtual size_t GetMaxStackUsage() override;
     virtual void SetMaxStackUsage(size_t value) override;
@@ -362,8 +482,17 @@ public:
     virtual V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code) override;
     virtual V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code, V8CacheType cacheType, std::vector<std::uint8_t>& cacheBytes) override;
     virtual V8ScriptHolder* Compile(const V8DocumentInfo& documentInfo, const StdString& code, V8CacheType cacheType, const std::vector<std::uint8_t>& cacheBytes, bool& cacheAccepted) override;
+    virtual SharedPtr<V8ScriptCompilation> CompileAsync(const V8DocumentInfo& documentInfo, const StdString& code) override;
     virtual void GetHeapInfo(V8IsolateHeapInfo& heapInfo) override;
+    virtual void GetHeapInfoSnapshot(V8IsolateHeapInfo& heapInfo) override;
     virtual void CollectGarbage(bool exhaustive) override;
+    virtual void NotifyIdle(double idleTimeInSeconds) override;
+    virtual void DrainMicrotasks(double timeBudgetInSeconds) override;
+
+    virtual void SetCodeCacheDirectory(const StdString& directoryPath) override;
+    virtual void GetCodeCacheInfo(V8IsolateCodeCacheInfo& codeCacheInfo) override;
+    virtual void GetCallWithLockLatencyHistogram(std::vector<std::uint64_t>& histogram) override;
+    SharedPtr<V8CodeCacheStore> GetCodeCacheStore();
 
     virtual void runMessageLoopOnPause(int contextGroupId) override;
     virtual void quitMessageLoopOnPause() override;
@@ -381,26 +510,84 @@ public:
     void* AddRefV8Script(void* pvScript);
     void ReleaseV8Script(void* pvScript);
 
-    void RunTaskAsync(v8::Task* pTask);
+    bool TryGetSharedScript(std::uint64_t id, const StdString& resourceName, v8::Local<v8::UnboundScript>& hScript);
+    void AddSharedScript(const SharedPtr<V8SharedScript>& spSharedScript, const StdString& resourceName, v8::Local<v8::UnboundScript> hScript);
+
+    v8::Local<v8::ArrayBuffer> CreateExternalArrayBuffer(void* pvData, size_t size, HostObjectHelpers::NativeCallback&& releaseCallback);
+    SharedPtr<V8SharedArrayBufferStore> GetSharedArrayBufferStore(v8::Local<v8::SharedArrayBuffer> hSharedArrayBuffer);
+    v8::Local<v8::SharedArrayBuffer> ImportSharedArrayBuffer(const SharedPtr<V8SharedArrayBufferStore>& spSharedArrayBufferStore);
+
+    void RunTaskAsync(v8::Task* pTask, V8WorkerPool::Priority priority);
+    void RunTaskAsync(std::shared_ptr<v8::Task>&& spTask, V8WorkerPool::Priority priority);
     void RunTaskDelayed(v8::Task* pTask, double delayInSeconds);
     void RunTaskWithLockAsync(v8::Task* pTask);
     void RunTaskWithLockDelayed(v8::Task* pTask, double delayInSeconds);
     std::shared_ptr<v8::TaskRunner> GetForegroundTaskRunner();
+    void PostIdleTask(std::unique_ptr<v8::IdleTask>&& spTask);
 
-    void CallWithLockNoWait(std::function<void(V8IsolateImpl*)>&& callback);
+    void CallWithLockNoWait(V8CallWithLockQueue::Callback&& callback);
     void DECLSPEC_NORETURN ThrowOutOfMemoryException();
+    void DECLSPEC_NORETURN ThrowThreadAffinityException();
 
     ~V8IsolateImpl();
 
 private:
 
+    struct SharedScriptEntry
+    {
+        WeakRef<V8SharedScript> wrSharedScript;
+        Persistent<v8::UnboundScript> hScript;
+    };
+
+    struct AllocationSample
+    {
+        double Time = 0;
+        size_t Size = 0;
+        double Rate = 0;
+    };
+
+    struct ExternalArrayBuffer
+    {
+        HostObjectHelpers::NativeCallback ReleaseCallback;
+        SharedPtr<V8SharedArrayBufferStore> spSharedArrayBufferStore;
+        Persistent<v8::Object> hArrayBuffer;
+    };
+
+    void LockMutex()
+    {
+        if (!m_Mutex.TryLock())
+        {
+            WaitForMutex();
+        }
+
+        OnMutexLocked();
+    }
+
+    bool TryLockMutex()
+    {
+        if (m_Mutex.TryLock())
+        {
+            OnMutexLocked();
+            return true;
+        }
+
+        return false;
+    }
+
+    void WaitForMutex();
+    void WaitForHandoff(std::uint64_t handoffCount);
+    void OnMutexLocked();
+    void UnlockMutex();
+    static void OnTimeSliceExpired(v8::Isolate* pIsolate, void* pvIsolateImpl);
+    void YieldToWaiters();
+
     bool RunMessageLoop(bool awaitingDebugger);
 
-    void CallWithLockAsync(std::function<void(V8IsolateImpl*)>&& callback);
+    void CallWithLockAsync(V8CallWithLockQueue::Callback&& callback);
     static void ProcessCallWithLockQueue(v8::Isolate* pIsolate, void* pvIsolateImpl);
     void ProcessCallWithLockQueue();
     void ProcessCallWithLockQueue(std::unique_lock<std::mutex>& lock);
-    void ProcessCallWithLockQueue(std::queue<std::function<void(V8IsolateImpl*)>>& callWithLockQueue);
+    void ProcessCallWithLockQueueIfNecessary();
 
     void ConnectDebugClient();
     void SendDebugCommand(const StdString& command);
@@ -409,36 +596,74 @@ private:
     ExecutionScope* EnterExecutionScope(ExecutionScope* pExecutionScope, size_t* pStackMarker);
     void ExitExecutionScope(ExecutionScope* pPreviousExecutionScope);
 
-    void SetUpHeapWatchTimer(size_t maxHeapSize);
+    size_t GetMonitoredHeapSize();
     void CheckHeapSize(size_t maxHeapSize);
+    void CaptureHeapInfo(V8IsolateHeapInfo& heapInfo);
+    void SetAllocationRate(V8IsolateHeapInfo& heapInfo, AllocationSample& sample);
+    static void OnGCPrologue(v8::Isolate* pIsolate, v8::GCType type, v8::GCCallbackFlags flags, void* pvIsolateImpl);
+    void OnGCPrologue();
+    static void OnGCEpilogue(v8::Isolate* pIsolate, v8::GCType type, v8::GCCallbackFlags flags, void* pvIsolateImpl);
+    void OnGCEpilogue(v8::GCType type);
+    static void OnHeapSizeCheckRequested(v8::Isolate* pIsolate, void* pvIsolateImpl);
+    static size_t OnNearHeapLimit(void* pvIsolateImpl, size_t currentHeapLimit, size_t initialHeapLimit);
+    size_t OnNearHeapLimit(size_t currentHeapLimit, size_t initialHeapLimit);
 
     static void OnBeforeCallEntered(v8::Isolate* pIsolate);
     void OnBeforeCallEntered();
 
+    void AddExternalArrayBuffer(v8::Local<v8::Object> hArrayBuffer, HostObjectHelpers::NativeCallback&& releaseCallback, const SharedPtr<V8SharedArrayBufferStore>& spSharedArrayBufferStore);
+    static void OnExternalArrayBufferCollected(v8::Isolate* pIsolate, Persistent<v8::Object>* phArrayBuffer, V8IsolateImpl* pIsolateImpl, ExternalArrayBuffer* pExternalArrayBuffer);
+
     StdString m_Name;
+    SharedPtr<V8SnapshotBlob> m_spSnapshotBlob;
+    v8::StartupData m_SnapshotData;
+    std::unique_ptr<V8ArrayBufferAllocator> m_spArrayBufferAllocator;
     v8::Isolate* m_pIsolate;
     Persistent<v8::Private> m_hHostObjectHolderKey;
     RecursiveMutex m_Mutex;
+    size_t m_MutexLockDepth;
+    SimpleMutex m_HandoffMutex;
+    std::condition_variable m_HandoffChanged;
+    size_t m_MutexWaiterCount;
+    std::uint64_t m_MutexHandoffCount;
+    std::atomic<double> m_TimeSliceInterval;
+    std::thread::id m_TimeSliceThreadId;
+    double m_TimeSliceStartTime;
+    bool m_ThreadAffine;
+    std::thread::id m_OwnerThreadId;
+    std::unique_ptr<v8::Locker> m_spOwnerLocker;
     std::list<V8ContextImpl*> m_ContextPtrs;
     SimpleMutex m_DataMutex;
     std::shared_ptr<v8::TaskRunner> m_spForegroundTaskRunner;
-    std::vector<std::shared_ptr<v8::Task>> m_AsyncTasks;
-    std::queue<std::function<void(V8IsolateImpl*)>> m_CallWithLockQueue;
+    std::unordered_set<std::shared_ptr<v8::Task>> m_AsyncTasks;
+    std::deque<std::unique_ptr<v8::IdleTask>> m_IdleTasks;
+    V8CallWithLockQueue m_CallWithLockQueue;
+    std::atomic<bool> m_CallWithLockInterruptPending;
     std::condition_variable m_CallWithLockQueueChanged;
-    std::vector<SharedPtr<Timer>> m_TaskTimers;
+    SharedPtr<V8CodeCacheStore> m_spCodeCacheStore;
+    std::map<std::pair<std::uint64_t, StdString>, SharedScriptEntry> m_SharedScripts;
+    std::unordered_set<ExternalArrayBuffer*> m_ExternalArrayBuffers;
+    std::unordered_map<void*, ExternalArrayBuffer*> m_SharedArrayBuffers;
     bool m_DebuggingEnabled;
     int m_DebugPort;
     void* m_pvDebugAgent;
     std::unique_ptr<v8_inspector::V8Inspector> m_spInspector;
     std::unique_ptr<v8_inspector::V8InspectorSession> m_spInspectorSession;
     bool m_AwaitingDebugger;
-    bool m_InMessageLoop;
+    std::atomic<bool> m_InMessageLoop;
     bool m_QuitMessageLoop;
     bool m_AbortMessageLoop;
     std::atomic<size_t> m_MaxHeapSize;
     std::atomic<double> m_HeapSizeSampleInterval;
     size_t m_HeapWatchLevel;
-    SharedPtr<Timer> m_spHeapWatchTimer;
+    bool m_HeapSizeCheckPending;
+    double m_HeapSizeCheckTime;
+    size_t m_HeapAllocatedSize;
+    size_t m_HeapUsedSizeAfterGC;
+    SimpleMutex m_HeapInfoMutex;
+    V8IsolateHeapInfo m_HeapInfoSnapshot;
+    AllocationSample m_HeapInfoAllocationSample;
+    AllocationSample m_SnapshotAllocationSample;
     std::atomic<size_t> m_MaxStackUsage;
     size_t m_StackWatchLevel;
     size_t* m_pStackLimit;
@@ -11,7 +11,7 @@ namespace V8 {
     // V8IsolateProxyImpl implementation
     //-------------------------------------------------------------------------
 
-    V8IsolateProxyImpl::V8IsolateProxyImpl(String^ gcName, V8RuntimeConstraints^ gcConstraints, V8RuntimeFlags flags, Int32 debugPort):
+    V8IsolateProxyImpl::V8IsolateProxyImpl(String^ gcName, V8RuntimeConstraints^ gcConstraints, V8RuntimeFlags flags, Int32 debugPort, V8SnapshotProxy^ gcSnapshotProxy):
         m_gcLock(gcnew Object)
     {
         const V8IsolateConstraints* pConstraints = nullptr;
@@ -26,8 +26,15 @@ namespace V8 {
         V8Isolate::Options options;
         options.EnableDebugging = flags.HasFlag(V8RuntimeFlags::EnableDebugging);
         options.EnableRemoteDebugging = flags.HasFlag(V8RuntimeFlags::EnableRemoteDebugging);
+        options.EnableThreadAffinity = flags.HasFlag(V8RuntimeFlags::EnableThreadAffinity);
+        options.EnableExplicitMicrotasks = flags.HasFlag(V8RuntimeFlags::EnableExplicitMicrotasks);
         options.DebugPort = debugPort;
 
+        if (gcSnapshotProxy != nullptr)
+        {
+            options.SnapshotBlob = safe_cast<V8SnapshotProxyImpl^>(gcSnapshotProxy)->GetSnapshotBlob();
+        }
+
         try
         {
             m_pspIsolate = new SharedPtr<V8Isolate>(V8Isolate::Create(StdString(gcName), pConstraints, options));
@@ -68,6 +75,20 @@ namespace V8 {
 
     //-------------------------------------------------------------------------
 
+    TimeSpan V8IsolateProxyImpl::TimeSliceInterval::get()
+    {
+        return TimeSpan::FromMilliseconds(GetIsolate()->GetTimeSliceInterval());
+    }
+
+    //-------------------------------------------------------------------------
+
+    void V8IsolateProxyImpl::TimeSliceInterval::set(TimeSpan value)
+    {
+        GetIsolate()->SetTimeSliceInterval(value.TotalMilliseconds);
+    }
+
+    //-------------------------------------------------------------------------
+
     UIntPtr V8IsolateProxyImpl::MaxStackUsage::get()
     {
         return (UIntPtr)GetIsolate()->GetMaxStackUsage();
@@ -112,9 +133,6 @@ namespace V8 {
 
     V8Script^ V8IsolateProxyImpl::Compile(DocumentInfo documentInfo, String^ gcCode, V8CacheKind cacheKind, [Out] array<Byte>^% gcCacheBytes)
     {
-        #pragma warning(push)
-        #pragma warning(disable:4947) /* 'Microsoft::ClearScript::V8::V8CacheKind::Parser': marked as obsolete */
-
         if (cacheKind == V8CacheKind::None)
         {
             gcCacheBytes = nullptr;
@@ -124,7 +142,7 @@ namespace V8 {
         try
         {
             std::vector<std::uint8_t> cacheBytes;
-            auto cacheType = (cacheKind == V8CacheKind::Parser) ? V8CacheType::Parser : V8CacheType::Code;
+            auto cacheType = GetCacheType(cacheKind);
             auto gcScript = gcnew V8ScriptImpl(documentInfo, GetIsolate()->Compile(V8DocumentInfo(documentInfo), StdString(gcCode), cacheType, cacheBytes));
 
             auto length = static_cast<int>(cacheBytes.size());
@@ -144,17 +162,12 @@ namespace V8 {
         {
             exception.ThrowScriptEngineException();
         }
-
-        #pragma warning(pop)
     }
 
     //-------------------------------------------------------------------------
 
     V8Script^ V8IsolateProxyImpl::Compile(DocumentInfo documentInfo, String^ gcCode, V8CacheKind cacheKind, array<Byte>^ gcCacheBytes, [Out] Boolean% cacheAccepted)
     {
-        #pragma warning(push)
-        #pragma warning(disable:4947) /* 'Microsoft::ClearScript::V8::V8CacheKind::Parser': marked as obsolete */
-
         if ((cacheKind == V8CacheKind::None) || (gcCacheBytes == nullptr) || (gcCacheBytes->Length < 1))
         {
             cacheAccepted = false;
@@ -168,7 +181,7 @@ namespace V8 {
             Marshal::Copy(gcCacheBytes, 0, (IntPtr)&cacheBytes[0], length);
 
             bool tempCacheAccepted;
-            auto cacheType = (cacheKind == V8CacheKind::Parser) ? V8CacheType::Parser : V8CacheType::Code;
+            auto cacheType = GetCacheType(cacheKind);
             auto gcScript = gcnew V8ScriptImpl(documentInfo, GetIsolate()->Compile(V8DocumentInfo(documentInfo), StdString(gcCode), cacheType, cacheBytes, tempCacheAccepted));
 
             cacheAccepted = tempCacheAccepted;
@@ -178,8 +191,20 @@ namespace V8 {
         {
             exception.ThrowScriptEngineException();
         }
+    }
 
-        #pragma warning(pop)
+    //-------------------------------------------------------------------------
+
+    Task<V8Script^>^ V8IsolateProxyImpl::CompileAsync(DocumentInfo documentInfo, String^ gcCode)
+    {
+        try
+        {
+            return V8ScriptImpl::FromCompilation(documentInfo, GetIsolate()->CompileAsync(V8DocumentInfo(documentInfo), StdString(gcCode)));
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -188,14 +213,16 @@ namespace V8 {
     {
         V8IsolateHeapInfo heapInfo;
         GetIsolate()->GetHeapInfo(heapInfo);
+        return CreateHeapInfo(heapInfo);
+    }
 
-        auto gcHeapInfo = gcnew V8RuntimeHeapInfo();
-        gcHeapInfo->TotalHeapSize = heapInfo.GetTotalHeapSize();
-        gcHeapInfo->TotalHeapSizeExecutable = heapInfo.GetTotalHeapSizeExecutable();
-        gcHeapInfo->TotalPhysicalSize = heapInfo.GetTotalPhysicalSize();
-        gcHeapInfo->UsedHeapSize = heapInfo.GetUsedHeapSize();
-        gcHeapInfo->HeapSizeLimit = heapInfo.GetHeapSizeLimit();
-        return gcHeapInfo;
+    //-------------------------------------------------------------------------
+
+    V8RuntimeHeapInfo^ V8IsolateProxyImpl::GetHeapInfoSnapshot()
+    {
+        V8IsolateHeapInfo heapInfo;
+        GetIsolate()->GetHeapInfoSnapshot(heapInfo);
+        return CreateHeapInfo(heapInfo);
     }
 
     //-------------------------------------------------------------------------
@@ -207,6 +234,67 @@ namespace V8 {
 
     //-------------------------------------------------------------------------
 
+    void V8IsolateProxyImpl::NotifyIdle(TimeSpan idleTime)
+    {
+        GetIsolate()->NotifyIdle(idleTime.TotalSeconds);
+    }
+
+    //-------------------------------------------------------------------------
+
+    void V8IsolateProxyImpl::DrainMicrotasks(TimeSpan timeBudget)
+    {
+        try
+        {
+            GetIsolate()->DrainMicrotasks(timeBudget.TotalSeconds);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void V8IsolateProxyImpl::SetCodeCacheDirectory(String^ gcDirectoryPath)
+    {
+        GetIsolate()->SetCodeCacheDirectory((gcDirectoryPath != nullptr) ? StdString(gcDirectoryPath) : StdString());
+    }
+
+    //-------------------------------------------------------------------------
+
+    V8RuntimeCodeCacheInfo^ V8IsolateProxyImpl::GetCodeCacheInfo()
+    {
+        V8IsolateCodeCacheInfo codeCacheInfo;
+        GetIsolate()->GetCodeCacheInfo(codeCacheInfo);
+
+        auto gcCodeCacheInfo = gcnew V8RuntimeCodeCacheInfo();
+        gcCodeCacheInfo->HitCount = codeCacheInfo.GetHitCount();
+        gcCodeCacheInfo->MissCount = codeCacheInfo.GetMissCount();
+        gcCodeCacheInfo->AcceptedCount = codeCacheInfo.GetAcceptedCount();
+        gcCodeCacheInfo->RejectedCount = codeCacheInfo.GetRejectedCount();
+        gcCodeCacheInfo->StoredCount = codeCacheInfo.GetStoredCount();
+        return gcCodeCacheInfo;
+    }
+
+    //-------------------------------------------------------------------------
+
+    array<UInt64>^ V8IsolateProxyImpl::GetCallWithLockLatencyHistogram()
+    {
+        std::vector<std::uint64_t> histogram;
+        GetIsolate()->GetCallWithLockLatencyHistogram(histogram);
+
+        auto length = static_cast<int>(histogram.size());
+        auto gcHistogram = gcnew array<UInt64>(length);
+        for (auto index = 0; index < length; index++)
+        {
+            gcHistogram[index] = histogram[index];
+        }
+
+        return gcHistogram;
+    }
+
+    //-------------------------------------------------------------------------
+
     SharedPtr<V8Isolate> V8IsolateProxyImpl::GetIsolate()
     {
         BEGIN_LOCK_SCOPE(m_gcLock)
@@ -272,6 +360,62 @@ namespace V8 {
 
     //-------------------------------------------------------------------------
 
+    V8CacheType V8IsolateProxyImpl::GetCacheType(V8CacheKind cacheKind)
+    {
+        #pragma warning(push)
+        #pragma warning(disable:4947) /* 'Microsoft::ClearScript::V8::V8CacheKind::Parser': marked as obsolete */
+
+        if (cacheKind == V8CacheKind::Parser)
+        {
+            return V8CacheType::Parser;
+        }
+
+        #pragma warning(pop)
+
+        return (cacheKind == V8CacheKind::EagerCode) ? V8CacheType::EagerCode : V8CacheType::Code;
+    }
+
+    //-------------------------------------------------------------------------
+
+    V8RuntimeHeapInfo^ V8IsolateProxyImpl::CreateHeapInfo(const V8IsolateHeapInfo& heapInfo)
+    {
+        auto gcHeapInfo = gcnew V8RuntimeHeapInfo();
+        gcHeapInfo->TotalHeapSize = heapInfo.GetTotalHeapSize();
+        gcHeapInfo->TotalHeapSizeExecutable = heapInfo.GetTotalHeapSizeExecutable();
+        gcHeapInfo->TotalPhysicalSize = heapInfo.GetTotalPhysicalSize();
+        gcHeapInfo->UsedHeapSize = heapInfo.GetUsedHeapSize();
+        gcHeapInfo->HeapSizeLimit = heapInfo.GetHeapSizeLimit();
+        gcHeapInfo->ArrayBufferSize = heapInfo.GetArrayBufferSize();
+        gcHeapInfo->PeakArrayBufferSize = heapInfo.GetPeakArrayBufferSize();
+        gcHeapInfo->ArrayBufferCount = heapInfo.GetArrayBufferCount();
+        gcHeapInfo->TotalAvailableSize = heapInfo.GetTotalAvailableSize();
+        gcHeapInfo->MallocedMemorySize = heapInfo.GetMallocedMemory();
+        gcHeapInfo->PeakMallocedMemorySize = heapInfo.GetPeakMallocedMemory();
+        gcHeapInfo->ExternalMemorySize = heapInfo.GetExternalMemory();
+        gcHeapInfo->NativeContextCount = heapInfo.GetNativeContextCount();
+        gcHeapInfo->DetachedContextCount = heapInfo.GetDetachedContextCount();
+        gcHeapInfo->TotalAllocatedSize = heapInfo.GetTotalAllocatedSize();
+        gcHeapInfo->AllocationRate = heapInfo.GetAllocationRate();
+
+        const auto& spaceInfo = heapInfo.GetSpaceInfo();
+        auto gcSpaceInfo = gcnew System::Collections::Generic::List<V8RuntimeHeapSpaceInfo^>(static_cast<int>(spaceInfo.size()));
+        for (const auto& info : spaceInfo)
+        {
+            auto gcInfo = gcnew V8RuntimeHeapSpaceInfo();
+            gcInfo->Name = (info.GetName() != nullptr) ? Marshal::PtrToStringAnsi(IntPtr(const_cast<char*>(info.GetName()))) : String::Empty;
+            gcInfo->Size = info.GetSize();
+            gcInfo->UsedSize = info.GetUsedSize();
+            gcInfo->AvailableSize = info.GetAvailableSize();
+            gcInfo->PhysicalSize = info.GetPhysicalSize();
+            gcSpaceInfo->Add(gcInfo);
+        }
+
+        gcHeapInfo->SpaceInfo = gcSpaceInfo->AsReadOnly();
+        return gcHeapInfo;
+    }
+
+    //-------------------------------------------------------------------------
+
     ENSURE_INTERNAL_CLASS(V8IsolateProxyImpl)
 
 }}}
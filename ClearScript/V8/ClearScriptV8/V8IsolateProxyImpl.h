@@ -15,7 +15,7 @@ namespace V8 {
     {
     public:
 
-        V8IsolateProxyImpl(String^ gcName, V8RuntimeConstraints^ gcConstraints, V8RuntimeFlags flags, Int32 debugPort);
+        V8IsolateProxyImpl(String^ gcName, V8RuntimeConstraints^ gcConstraints, V8RuntimeFlags flags, Int32 debugPort, V8SnapshotProxy^ gcSnapshotProxy);
 
         property UIntPtr MaxHeapSize
         {
@@ -29,6 +29,12 @@ namespace V8 {
             virtual void set(TimeSpan value) override;
         }
 
+        property TimeSpan TimeSliceInterval
+        {
+            virtual TimeSpan get() override;
+            virtual void set(TimeSpan value) override;
+        }
+
         property UIntPtr MaxStackUsage
         {
             virtual UIntPtr get() override;
@@ -39,18 +45,26 @@ namespace V8 {
         virtual V8Script^ Compile(DocumentInfo documentInfo, String^ gcCode) override;
         virtual V8Script^ Compile(DocumentInfo documentInfo, String^ gcCode, V8CacheKind cacheKind, [Out] array<Byte>^% gcCacheBytes) override;
         virtual V8Script^ Compile(DocumentInfo documentInfo, String^ gcCode, V8CacheKind cacheKind, array<Byte>^ gcCacheBytes, [Out] Boolean% cacheAccepted) override;
+        virtual Task<V8Script^>^ CompileAsync(DocumentInfo documentInfo, String^ gcCode) override;
         virtual V8RuntimeHeapInfo^ GetHeapInfo() override;
+        virtual V8RuntimeHeapInfo^ GetHeapInfoSnapshot() override;
         virtual void CollectGarbage(bool exhaustive) override;
+        virtual void NotifyIdle(TimeSpan idleTime) override;
+        virtual void DrainMicrotasks(TimeSpan timeBudget) override;
+        virtual void SetCodeCacheDirectory(String^ gcDirectoryPath) override;
+        virtual V8RuntimeCodeCacheInfo^ GetCodeCacheInfo() override;
+        virtual array<UInt64>^ GetCallWithLockLatencyHistogram() override;
 
         SharedPtr<V8Isolate> GetIsolate();
+        static int AdjustConstraint(int value);
+        static V8CacheType GetCacheType(V8CacheKind cacheKind);
+        static V8RuntimeHeapInfo^ CreateHeapInfo(const V8IsolateHeapInfo& heapInfo);
 
         ~V8IsolateProxyImpl();
         !V8IsolateProxyImpl();
 
     private:
 
-        static int AdjustConstraint(int value);
-
         Object^ m_gcLock;
         SharedPtr<V8Isolate>* m_pspIsolate;
     };
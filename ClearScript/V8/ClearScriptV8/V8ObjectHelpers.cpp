@@ -44,6 +44,27 @@ void V8ObjectHelpers::GetPropertyNames(V8ObjectHolder* pHolder, std::vector<StdS
 
 //-----------------------------------------------------------------------------
 
+void V8ObjectHelpers::GetProperties(V8ObjectHolder* pHolder, const std::vector<StdString>& names, std::vector<V8Value>& values)
+{
+    GetHolderImpl(pHolder)->GetProperties(names, values);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ObjectHelpers::SetProperties(V8ObjectHolder* pHolder, const std::vector<StdString>& names, const std::vector<V8Value>& values)
+{
+    GetHolderImpl(pHolder)->SetProperties(names, values);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ObjectHelpers::ExportGraph(V8ObjectHolder* pHolder, int maxDepth, size_t maxSize, std::vector<std::uint8_t>& graph)
+{
+    GetHolderImpl(pHolder)->ExportGraph(maxDepth, maxSize, graph);
+}
+
+//-----------------------------------------------------------------------------
+
 V8Value V8ObjectHelpers::GetProperty(V8ObjectHolder* pHolder, int index)
 {
     return GetHolderImpl(pHolder)->GetProperty(index);
@@ -97,3 +118,10 @@ void V8ObjectHelpers::InvokeWithArrayBufferOrViewData(V8ObjectHolder* pHolder, A
 {
     return GetHolderImpl(pHolder)->InvokeWithArrayBufferOrViewData(pCallback, pvArg);
 }
+
+//-----------------------------------------------------------------------------
+
+V8ObjectHolder* V8ObjectHelpers::CreateSharedArrayBufferHolder(V8ObjectHolder* pHolder)
+{
+    return GetHolderImpl(pHolder)->CreateSharedArrayBufferHolder();
+}
@@ -17,6 +17,9 @@ public:
     static void SetProperty(V8ObjectHolder* pHolder, const StdString& name, const V8Value& value);
     static bool DeleteProperty(V8ObjectHolder* pHolder, const StdString& name);
     static void GetPropertyNames(V8ObjectHolder* pHolder, std::vector<StdString>& names);
+    static void GetProperties(V8ObjectHolder* pHolder, const std::vector<StdString>& names, std::vector<V8Value>& values);
+    static void SetProperties(V8ObjectHolder* pHolder, const std::vector<StdString>& names, const std::vector<V8Value>& values);
+    static void ExportGraph(V8ObjectHolder* pHolder, int maxDepth, size_t maxSize, std::vector<std::uint8_t>& graph);
 
     static V8Value GetProperty(V8ObjectHolder* pHolder, int index);
     static void SetProperty(V8ObjectHolder* pHolder, int index, const V8Value& value);
@@ -29,4 +32,5 @@ public:
     typedef void ArrayBufferOrViewDataCallbackT(void* pvData, void* pvArg);
     static void GetArrayBufferOrViewInfo(V8ObjectHolder* pHolder, V8Value& arrayBuffer, size_t& offset, size_t& size, size_t& length);
     static void InvokeWithArrayBufferOrViewData(V8ObjectHolder* pHolder, ArrayBufferOrViewDataCallbackT* pCallback, void* pvArg);
+    static V8ObjectHolder* CreateSharedArrayBufferHolder(V8ObjectHolder* pHolder);
 };
@@ -15,9 +15,19 @@ V8ObjectHolderImpl::V8ObjectHolderImpl(V8WeakContextBinding* pBinding, void* pvO
 
 //-----------------------------------------------------------------------------
 
+V8ObjectHolderImpl::V8ObjectHolderImpl(V8WeakContextBinding* pBinding, void* pvObject, const SharedPtr<V8SharedArrayBufferStore>& spSharedArrayBufferStore):
+    m_spBinding(pBinding),
+    m_pvObject(pvObject),
+    m_spSharedArrayBufferStore(spSharedArrayBufferStore)
+{
+}
+
+//-----------------------------------------------------------------------------
+
 V8ObjectHolderImpl* V8ObjectHolderImpl::Clone() const
 {
-    return new V8ObjectHolderImpl(m_spBinding, m_spBinding->GetIsolateImpl()->AddRefV8Object(m_pvObject));
+    auto pvObject = (m_pvObject != nullptr) ? m_spBinding->GetIsolateImpl()->AddRefV8Object(m_pvObject) : nullptr;
+    return new V8ObjectHolderImpl(m_spBinding, pvObject, m_spSharedArrayBufferStore);
 }
 
 //-----------------------------------------------------------------------------
@@ -57,6 +67,27 @@ void V8ObjectHolderImpl::GetPropertyNames(std::vector<StdString>& names) const
 
 //-----------------------------------------------------------------------------
 
+void V8ObjectHolderImpl::GetProperties(const std::vector<StdString>& names, std::vector<V8Value>& values) const
+{
+    m_spBinding->GetContextImpl()->GetV8ObjectProperties(m_pvObject, names, values);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ObjectHolderImpl::SetProperties(const std::vector<StdString>& names, const std::vector<V8Value>& values) const
+{
+    m_spBinding->GetContextImpl()->SetV8ObjectProperties(m_pvObject, names, values);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ObjectHolderImpl::ExportGraph(int maxDepth, size_t maxSize, std::vector<std::uint8_t>& graph) const
+{
+    m_spBinding->GetContextImpl()->ExportV8ObjectGraph(m_pvObject, maxDepth, maxSize, graph);
+}
+
+//-----------------------------------------------------------------------------
+
 V8Value V8ObjectHolderImpl::GetProperty(int index) const
 {
     return m_spBinding->GetContextImpl()->GetV8ObjectProperty(m_pvObject, index);
@@ -113,10 +144,21 @@ void V8ObjectHolderImpl::InvokeWithArrayBufferOrViewData(V8ObjectHelpers::ArrayB
 
 //-----------------------------------------------------------------------------
 
+V8ObjectHolderImpl* V8ObjectHolderImpl::CreateSharedArrayBufferHolder() const
+{
+    // The new holder refers only to the backing store. Unlike a clone, it can be created and
+    // imported without locking the isolate that owns the original SharedArrayBuffer.
+
+    _ASSERTE(!m_spSharedArrayBufferStore.IsEmpty());
+    return new V8ObjectHolderImpl(m_spBinding, nullptr, m_spSharedArrayBufferStore);
+}
+
+//-----------------------------------------------------------------------------
+
 V8ObjectHolderImpl::~V8ObjectHolderImpl()
 {
     SharedPtr<V8IsolateImpl> spIsolateImpl;
-    if (m_spBinding->TryGetIsolateImpl(spIsolateImpl))
+    if ((m_pvObject != nullptr) && m_spBinding->TryGetIsolateImpl(spIsolateImpl))
     {
         spIsolateImpl->ReleaseV8Object(m_pvObject);
     }
@@ -14,6 +14,7 @@ class V8ObjectHolderImpl: public V8ObjectHolder
 public:
 
     V8ObjectHolderImpl(V8WeakContextBinding* pBinding, void* pvObject);
+    V8ObjectHolderImpl(V8WeakContextBinding* pBinding, void* pvObject, const SharedPtr<V8SharedArrayBufferStore>& spSharedArrayBufferStore);
 
     virtual V8ObjectHolderImpl* Clone() const override;
     virtual void* GetObject() const override;
@@ -22,6 +23,9 @@ public:
     void SetProperty(const StdString& name, const V8Value& value) const;
     bool DeleteProperty(const StdString& name) const;
     void GetPropertyNames(std::vector<StdString>& names) const;
+    void GetProperties(const std::vector<StdString>& names, std::vector<V8Value>& values) const;
+    void SetProperties(const std::vector<StdString>& names, const std::vector<V8Value>& values) const;
+    void ExportGraph(int maxDepth, size_t maxSize, std::vector<std::uint8_t>& graph) const;
 
     V8Value GetProperty(int index) const;
     void SetProperty(int index, const V8Value& value) const;
@@ -34,10 +38,14 @@ public:
     void GetArrayBufferOrViewInfo(V8Value& arrayBuffer, size_t& offset, size_t& size, size_t& length) const;
     void InvokeWithArrayBufferOrViewData(V8ObjectHelpers::ArrayBufferOrViewDataCallbackT* pCallback, void* pvArg) const;
 
+    const SharedPtr<V8SharedArrayBufferStore>& GetSharedArrayBufferStore() const { return m_spSharedArrayBufferStore; }
+    V8ObjectHolderImpl* CreateSharedArrayBufferHolder() const;
+
     ~V8ObjectHolderImpl();
 
 private:
 
     SharedPtr<V8WeakContextBinding> m_spBinding;
     void* m_pvObject;
+    SharedPtr<V8SharedArrayBufferStore> m_spSharedArrayBufferStore;
 };
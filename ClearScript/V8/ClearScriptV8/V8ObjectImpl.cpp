@@ -103,6 +103,77 @@ namespace V8 {
 
     //-------------------------------------------------------------------------
 
+    array<Object^>^ V8ObjectImpl::GetProperties(array<String^>^ gcNames)
+    {
+        try
+        {
+            std::vector<StdString> importedNames;
+            ImportNames(gcNames, importedNames);
+
+            std::vector<V8Value> values;
+            V8ObjectHelpers::GetProperties(GetHolder(), importedNames, values);
+            auto valueCount = static_cast<int>(values.size());
+
+            auto gcValues = gcnew array<Object^>(valueCount);
+            for (auto index = 0; index < valueCount; index++)
+            {
+                gcValues[index] = V8ContextProxyImpl::ExportValue(values[index]);
+            }
+
+            return gcValues;
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void V8ObjectImpl::SetProperties(array<String^>^ gcNames, array<Object^>^ gcValues)
+    {
+        try
+        {
+            std::vector<StdString> importedNames;
+            ImportNames(gcNames, importedNames);
+
+            std::vector<V8Value> importedValues;
+            ImportValues(gcValues, importedValues);
+
+            V8ObjectHelpers::SetProperties(GetHolder(), importedNames, importedValues);
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    array<Byte>^ V8ObjectImpl::ExportGraph(int maxDepth, int maxSize)
+    {
+        try
+        {
+            std::vector<std::uint8_t> graph;
+            V8ObjectHelpers::ExportGraph(GetHolder(), maxDepth, static_cast<size_t>(maxSize), graph);
+
+            auto length = static_cast<int>(graph.size());
+            auto gcGraph = gcnew array<Byte>(length);
+            if (length > 0)
+            {
+                Marshal::Copy((IntPtr)&graph[0], gcGraph, 0, length);
+            }
+
+            return gcGraph;
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     Object^ V8ObjectImpl::GetProperty(int index)
     {
         try
@@ -216,6 +287,8 @@ namespace V8 {
 
         if (m_Subtype == V8Value::Subtype::ArrayBuffer)
             kind = V8ArrayBufferOrViewKind::ArrayBuffer;
+        else if (m_Subtype == V8Value::Subtype::SharedArrayBuffer)
+            kind = V8ArrayBufferOrViewKind::SharedArrayBuffer;
         else if (m_Subtype == V8Value::Subtype::DataView)
             kind = V8ArrayBufferOrViewKind::DataView;
         else if (m_Subtype == V8Value::Subtype::Uint8Array)
@@ -340,6 +413,23 @@ namespace V8 {
 
     //-------------------------------------------------------------------------
 
+    void V8ObjectImpl::ImportNames(array<String^>^ gcNames, std::vector<StdString>& importedNames)
+    {
+        importedNames.clear();
+        if (gcNames != nullptr)
+        {
+            auto nameCount = gcNames->Length;
+            importedNames.reserve(nameCount);
+
+            for (auto index = 0; index < nameCount; index++)
+            {
+                importedNames.push_back(StdString(gcNames[index]));
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void V8ObjectImpl::ImportValues(array<Object^>^ gcValues, std::vector<V8Value>& importedValues)
     {
         importedValues.clear();
@@ -22,6 +22,9 @@ namespace V8 {
         virtual void SetProperty(String^ gcName, Object^ gcValue);
         virtual bool DeleteProperty(String^ gcName);
         virtual array<String^>^ GetPropertyNames();
+        virtual array<Object^>^ GetProperties(array<String^>^ gcNames);
+        virtual void SetProperties(array<String^>^ gcNames, array<Object^>^ gcValues);
+        virtual array<Byte>^ ExportGraph(int maxDepth, int maxSize);
 
         virtual Object^ GetProperty(int index);
         virtual void SetProperty(int index, Object^ gcValue);
@@ -44,6 +47,7 @@ namespace V8 {
 
     private:
 
+        static void ImportNames(array<String^>^ gcNames, std::vector<StdString>& importedNames);
         static void ImportValues(array<Object^>^ gcValues, std::vector<V8Value>& importedValues);
 
         Object^ m_gcLock;
@@ -0,0 +1,21 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8ScriptCompilation
+//-----------------------------------------------------------------------------
+
+class V8ScriptCompilation: public SharedPtrTarget
+{
+public:
+
+    typedef std::function<void(V8ScriptCompilation* pCompilation)> CompletionCallback;
+
+    virtual bool IsCompleted() = 0;
+    virtual void SetCompletionCallback(CompletionCallback&& callback) = 0;
+    virtual V8ScriptHolder* GetScriptHolder() = 0;
+
+    virtual ~V8ScriptCompilation() {}
+};
@@ -0,0 +1,161 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Native.h"
+
+//-----------------------------------------------------------------------------
+// V8ScriptCompilationImpl::SourceStream implementation
+//-----------------------------------------------------------------------------
+
+V8ScriptCompilationImpl::SourceStream::SourceStream(const StdString& code):
+    m_Code(code),
+    m_Consumed(false)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+size_t V8ScriptCompilationImpl::SourceStream::GetMoreData(const std::uint8_t** ppData)
+{
+    // The entire source is already in memory, so it's delivered as a single UTF-16 chunk. V8
+    // takes ownership of the chunk and releases it, so it's allocated by V8 (see V8Patch.txt).
+
+    if (m_Consumed || (m_Code.GetLength() < 1))
+    {
+        *ppData = nullptr;
+        return 0;
+    }
+
+    m_Consumed = true;
+
+    auto size = m_Code.GetLength() * sizeof(wchar_t);
+    auto pData = v8::ScriptCompiler::StreamedSource::AllocateChunk(size);
+    memcpy(pData, m_Code.ToCString(), size);
+
+    *ppData = pData;
+    return size;
+}
+
+//-----------------------------------------------------------------------------
+// V8ScriptCompilationImpl implementation
+//-----------------------------------------------------------------------------
+
+V8ScriptCompilationImpl::V8ScriptCompilationImpl(const V8DocumentInfo& documentInfo, const StdString& code):
+    m_DocumentInfo(documentInfo),
+    m_Code(code),
+    m_StreamedSource(new SourceStream(m_Code), v8::ScriptCompiler::StreamedSource::TWO_BYTE),
+    m_IsCompleted(false)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ScriptCompilationImpl::SetStreamingTask(v8::ScriptCompiler::ScriptStreamingTask* pTask)
+{
+    m_spStreamingTask.reset(pTask);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ScriptCompilationImpl::RunStreamingTask()
+{
+    // the streaming task parses and compiles without the isolate lock
+    if (m_spStreamingTask)
+    {
+        m_spStreamingTask->Run();
+        m_spStreamingTask.reset();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ScriptCompilationImpl::Complete(V8ScriptHolder* pHolder)
+{
+    Complete(std::unique_ptr<V8ScriptHolder>(pHolder), std::unique_ptr<V8Exception>());
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ScriptCompilationImpl::Complete(const V8Exception& exception)
+{
+    Complete(std::unique_ptr<V8ScriptHolder>(), std::make_unique<V8Exception>(exception));
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8ScriptCompilationImpl::IsCompleted()
+{
+    BEGIN_MUTEX_SCOPE(m_Mutex)
+        return m_IsCompleted;
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ScriptCompilationImpl::SetCompletionCallback(CompletionCallback&& callback)
+{
+    BEGIN_MUTEX_SCOPE(m_Mutex)
+
+        if (!m_IsCompleted)
+        {
+            m_CompletionCallback = std::move(callback);
+            return;
+        }
+
+    END_MUTEX_SCOPE
+
+    InvokeCompletionCallback(std::move(callback));
+}
+
+//-----------------------------------------------------------------------------
+
+V8ScriptHolder* V8ScriptCompilationImpl::GetScriptHolder()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex.GetImpl());
+    m_CompletedChanged.wait(lock, [this] { return m_IsCompleted; });
+
+    if (m_spException)
+    {
+        throw *m_spException;
+    }
+
+    return m_spHolder->Clone();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ScriptCompilationImpl::Complete(std::unique_ptr<V8ScriptHolder>&& spHolder, std::unique_ptr<V8Exception>&& spException)
+{
+    CompletionCallback callback;
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex.GetImpl());
+
+        _ASSERTE(!m_IsCompleted);
+        m_spHolder = std::move(spHolder);
+        m_spException = std::move(spException);
+        m_IsCompleted = true;
+
+        std::swap(callback, m_CompletionCallback);
+        m_CompletedChanged.notify_all();
+    }
+
+    InvokeCompletionCallback(std::move(callback));
+}
+
+//-----------------------------------------------------------------------------
+
+void V8ScriptCompilationImpl::InvokeCompletionCallback(CompletionCallback&& callback)
+{
+    // Completion may occur on a thread that holds the isolate lock. The callback is dispatched to
+    // the thread pool so that continuations never run within isolate scope.
+
+    if (callback)
+    {
+        SharedPtr<V8ScriptCompilationImpl> spThis(this);
+        HostObjectHelpers::QueueNativeCallback([spThis, callback] ()
+        {
+            callback(spThis.GetRawPtr());
+        });
+    }
+}
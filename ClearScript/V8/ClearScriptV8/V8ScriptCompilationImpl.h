@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8ScriptCompilationImpl
+//-----------------------------------------------------------------------------
+
+class V8ScriptCompilationImpl: public V8ScriptCompilation
+{
+    PROHIBIT_COPY(V8ScriptCompilationImpl)
+
+public:
+
+    V8ScriptCompilationImpl(const V8DocumentInfo& documentInfo, const StdString& code);
+
+    const V8DocumentInfo& GetDocumentInfo() const { return m_DocumentInfo; }
+    const StdString& GetCode() const { return m_Code; }
+    v8::ScriptCompiler::StreamedSource* GetStreamedSource() { return &m_StreamedSource; }
+
+    void SetStreamingTask(v8::ScriptCompiler::ScriptStreamingTask* pTask);
+    void RunStreamingTask();
+
+    void Complete(V8ScriptHolder* pHolder);
+    void Complete(const V8Exception& exception);
+
+    virtual bool IsCompleted() override;
+    virtual void SetCompletionCallback(CompletionCallback&& callback) override;
+    virtual V8ScriptHolder* GetScriptHolder() override;
+
+private:
+
+    class SourceStream: public v8::ScriptCompiler::ExternalSourceStream
+    {
+        PROHIBIT_COPY(SourceStream)
+
+    public:
+
+        explicit SourceStream(const StdString& code);
+
+        virtual size_t GetMoreData(const std::uint8_t** ppData) override;
+
+    private:
+
+        const StdString& m_Code;
+        bool m_Consumed;
+    };
+
+    void Complete(std::unique_ptr<V8ScriptHolder>&& spHolder, std::unique_ptr<V8Exception>&& spException);
+    void InvokeCompletionCallback(CompletionCallback&& callback);
+
+    V8DocumentInfo m_DocumentInfo;
+    StdString m_Code;
+    v8::ScriptCompiler::StreamedSource m_StreamedSource;
+    std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask> m_spStreamingTask;
+
+    SimpleMutex m_Mutex;
+    std::condition_variable m_CompletedChanged;
+    bool m_IsCompleted;
+    std::unique_ptr<V8ScriptHolder> m_spHolder;
+    std::unique_ptr<V8Exception> m_spException;
+    CompletionCallback m_CompletionCallback;
+};
@@ -15,9 +15,18 @@ V8ScriptHolderImpl::V8ScriptHolderImpl(V8WeakContextBinding* pBinding, void* pvS
 
 //-----------------------------------------------------------------------------
 
+V8ScriptHolderImpl::V8ScriptHolderImpl(V8WeakContextBinding* pBinding, void* pvScript, const SharedPtr<V8SharedScript>& spSharedScript):
+    m_spBinding(pBinding),
+    m_pvScript(pvScript),
+    m_spSharedScript(spSharedScript)
+{
+}
+
+//-----------------------------------------------------------------------------
+
 V8ScriptHolderImpl* V8ScriptHolderImpl::Clone() const
 {
-    return new V8ScriptHolderImpl(m_spBinding, m_spBinding->GetIsolateImpl()->AddRefV8Script(m_pvScript));
+    return new V8ScriptHolderImpl(m_spBinding, m_spBinding->GetIsolateImpl()->AddRefV8Script(m_pvScript), m_spSharedScript);
 }
 
 //-----------------------------------------------------------------------------
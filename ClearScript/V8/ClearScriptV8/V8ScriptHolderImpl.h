@@ -14,15 +14,19 @@ class V8ScriptHolderImpl: public V8ScriptHolder
 public:
 
     V8ScriptHolderImpl(V8WeakContextBinding* pBinding, void* pvScript);
+    V8ScriptHolderImpl(V8WeakContextBinding* pBinding, void* pvScript, const SharedPtr<V8SharedScript>& spSharedScript);
 
     virtual V8ScriptHolderImpl* Clone() const override;
     virtual bool IsSameIsolate(void* pvIsolate) const override;
     virtual void* GetScript() const override;
 
+    const SharedPtr<V8SharedScript>& GetSharedScript() const { return m_spSharedScript; }
+
     ~V8ScriptHolderImpl();
 
 private:
 
     SharedPtr<V8WeakContextBinding> m_spBinding;
     void* m_pvScript;
+    SharedPtr<V8SharedScript> m_spSharedScript;
 };
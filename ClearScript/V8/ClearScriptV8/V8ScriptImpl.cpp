@@ -20,6 +20,22 @@ namespace V8 {
 
     //-------------------------------------------------------------------------
 
+    Task<V8Script^>^ V8ScriptImpl::FromCompilation(ClearScript::DocumentInfo documentInfo, const SharedPtr<V8ScriptCompilation>& spCompilation)
+    {
+        // the completion source carries the document information as its asynchronous state
+        auto gcCompletionSource = gcnew TaskCompletionSource<V8Script^>(documentInfo);
+        auto pvCompletionSource = V8ProxyHelpers::AddRefHostObject(gcCompletionSource);
+
+        spCompilation->SetCompletionCallback([pvCompletionSource] (V8ScriptCompilation* pCompilation)
+        {
+            OnCompilationCompleted(pvCompletionSource, pCompilation);
+        });
+
+        return gcCompletionSource->Task;
+    }
+
+    //-------------------------------------------------------------------------
+
     SharedPtr<V8ScriptHolder> V8ScriptImpl::GetHolder()
     {
         BEGIN_LOCK_SCOPE(m_gcLock)
@@ -69,4 +85,32 @@ namespace V8 {
         }
     }
 
+    //-------------------------------------------------------------------------
+
+    void V8ScriptImpl::OnCompilationCompleted(void* pvCompletionSource, V8ScriptCompilation* pCompilation)
+    {
+        auto gcCompletionSource = safe_cast<TaskCompletionSource<V8Script^>^>(V8ProxyHelpers::GetHostObject(pvCompletionSource));
+        V8ProxyHelpers::ReleaseHostObject(pvCompletionSource);
+
+        try
+        {
+            V8ScriptHolder* pHolder = nullptr;
+
+            try
+            {
+                pHolder = pCompilation->GetScriptHolder();
+            }
+            catch (const V8Exception& exception)
+            {
+                exception.ThrowScriptEngineException();
+            }
+
+            gcCompletionSource->SetResult(gcnew V8ScriptImpl(safe_cast<ClearScript::DocumentInfo>(gcCompletionSource->Task->AsyncState), pHolder));
+        }
+        catch (Exception^ gcException)
+        {
+            gcCompletionSource->SetException(gcException);
+        }
+    }
+
 }}}
@@ -16,6 +16,7 @@ namespace V8 {
     public:
 
         V8ScriptImpl(ClearScript::DocumentInfo documentInfo, V8ScriptHolder* pHolder);
+        static Task<V8Script^>^ FromCompilation(ClearScript::DocumentInfo documentInfo, const SharedPtr<V8ScriptCompilation>& spCompilation);
 
         SharedPtr<V8ScriptHolder> GetHolder();
 
@@ -24,6 +25,8 @@ namespace V8 {
 
     private:
 
+        static void OnCompilationCompleted(void* pvCompletionSource, V8ScriptCompilation* pCompilation);
+
         Object^ m_gcLock;
         SharedPtr<V8ScriptHolder>* m_pspHolder;
     };
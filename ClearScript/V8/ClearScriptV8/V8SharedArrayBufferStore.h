@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8SharedArrayBufferStore
+//
+// The externalized backing store of a SharedArrayBuffer. Each isolate that exposes the memory to
+// script code holds a reference for as long as its SharedArrayBuffer is alive, as do host-side
+// handles. The memory is released with the last reference.
+//-----------------------------------------------------------------------------
+
+class V8SharedArrayBufferStore: public SharedPtrTarget
+{
+    PROHIBIT_COPY(V8SharedArrayBufferStore)
+
+public:
+
+    V8SharedArrayBufferStore(void* pvData, size_t size):
+        m_pvData(pvData),
+        m_Size(size)
+    {
+    }
+
+    void* GetData() const { return m_pvData; }
+    size_t GetSize() const { return m_Size; }
+
+    ~V8SharedArrayBufferStore()
+    {
+        V8ArrayBufferAllocator::FreeUntracked(m_pvData, m_Size);
+    }
+
+private:
+
+    void* m_pvData;
+    size_t m_Size;
+};
@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Native.h"
+
+//-----------------------------------------------------------------------------
+// V8SharedScriptCache implementation
+//-----------------------------------------------------------------------------
+
+size_t V8SharedScriptCache::GetMaxSize()
+{
+    return V8SharedScriptCacheImpl::GetInstance().GetMaxSize();
+}
+
+//-----------------------------------------------------------------------------
+
+void V8SharedScriptCache::SetMaxSize(size_t maxSize)
+{
+    V8SharedScriptCacheImpl::GetInstance().SetMaxSize(maxSize);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8SharedScriptCache::GetStatistics(Statistics& statistics)
+{
+    V8SharedScriptCacheImpl::GetInstance().GetStatistics(statistics);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8SharedScriptCache::Clear()
+{
+    V8SharedScriptCacheImpl::GetInstance().Clear();
+}
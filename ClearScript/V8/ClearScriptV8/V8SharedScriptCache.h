@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8SharedScriptCache
+//-----------------------------------------------------------------------------
+
+class V8SharedScriptCache
+{
+public:
+
+    struct Statistics
+    {
+        size_t EntryCount = 0;
+        size_t Size = 0;
+        size_t MaxSize = 0;
+        std::uint64_t HitCount = 0;
+        std::uint64_t MissCount = 0;
+        std::uint64_t EvictionCount = 0;
+        std::uint64_t InstantiationCount = 0;
+    };
+
+    static size_t GetMaxSize();
+    static void SetMaxSize(size_t maxSize);
+    static void GetStatistics(Statistics& statistics);
+    static void Clear();
+};
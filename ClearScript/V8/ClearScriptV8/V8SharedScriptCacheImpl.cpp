@@ -0,0 +1,144 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Native.h"
+
+//-----------------------------------------------------------------------------
+// V8SharedScriptCacheImpl implementation
+//-----------------------------------------------------------------------------
+
+V8SharedScriptCacheImpl& V8SharedScriptCacheImpl::GetInstance()
+{
+    return ms_Instance;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8SharedScriptCacheImpl::SetMaxSize(size_t maxSize)
+{
+    BEGIN_MUTEX_SCOPE(m_Mutex)
+
+        m_MaxSize = maxSize;
+        TrimWithLock();
+
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+SharedPtr<V8SharedScript> V8SharedScriptCacheImpl::Find(const StdString& code)
+{
+    BEGIN_MUTEX_SCOPE(m_Mutex)
+
+        auto it = m_EntryMap.find(&code);
+        if (it == m_EntryMap.end())
+        {
+            ++m_MissCount;
+            return SharedPtr<V8SharedScript>();
+        }
+
+        // move the entry to the front of the recency list
+
+        m_Entries.splice(m_Entries.begin(), m_Entries, it->second);
+
+        ++m_HitCount;
+        return *it->second;
+
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+SharedPtr<V8SharedScript> V8SharedScriptCacheImpl::Add(const V8DocumentInfo& documentInfo, const StdString& code, std::vector<std::uint8_t>&& cacheBytes)
+{
+    BEGIN_MUTEX_SCOPE(m_Mutex)
+
+        // another isolate may have added the same script concurrently
+
+        auto it = m_EntryMap.find(&code);
+        if (it != m_EntryMap.end())
+        {
+            m_Entries.splice(m_Entries.begin(), m_Entries, it->second);
+            return *it->second;
+        }
+
+        SharedPtr<V8SharedScript> spSharedScript(new V8SharedScript(++m_NextId, documentInfo, code, std::move(cacheBytes)));
+        m_Entries.push_front(spSharedScript);
+        m_EntryMap.emplace(&spSharedScript->GetCode(), m_Entries.begin());
+        m_Size += spSharedScript->GetSize();
+
+        TrimWithLock();
+        return spSharedScript;
+
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+void V8SharedScriptCacheImpl::GetStatistics(V8SharedScriptCache::Statistics& statistics)
+{
+    BEGIN_MUTEX_SCOPE(m_Mutex)
+
+        statistics.EntryCount = m_Entries.size();
+        statistics.Size = m_Size;
+        statistics.MaxSize = m_MaxSize;
+        statistics.HitCount = m_HitCount;
+        statistics.MissCount = m_MissCount;
+        statistics.EvictionCount = m_EvictionCount;
+
+    END_MUTEX_SCOPE
+
+    statistics.InstantiationCount = m_InstantiationCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8SharedScriptCacheImpl::Clear()
+{
+    EntryList entries;
+
+    BEGIN_MUTEX_SCOPE(m_Mutex)
+
+        m_EntryMap.clear();
+        std::swap(entries, m_Entries);
+        m_Size = 0;
+        m_HitCount = 0;
+        m_MissCount = 0;
+        m_EvictionCount = 0;
+        m_InstantiationCount = 0;
+
+    END_MUTEX_SCOPE
+
+    // entries are released outside the lock
+}
+
+//-----------------------------------------------------------------------------
+
+V8SharedScriptCacheImpl::V8SharedScriptCacheImpl():
+    m_MaxSize(0),
+    m_Size(0),
+    m_NextId(0),
+    m_HitCount(0),
+    m_MissCount(0),
+    m_EvictionCount(0),
+    m_InstantiationCount(0)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void V8SharedScriptCacheImpl::TrimWithLock()
+{
+    while ((m_Size > m_MaxSize) && !m_Entries.empty())
+    {
+        const auto& spSharedScript = m_Entries.back();
+        m_EntryMap.erase(&spSharedScript->GetCode());
+        m_Size -= spSharedScript->GetSize();
+        m_Entries.pop_back();
+        ++m_EvictionCount;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+V8SharedScriptCacheImpl V8SharedScriptCacheImpl::ms_Instance;
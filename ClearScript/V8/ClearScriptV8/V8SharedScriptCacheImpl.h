@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8SharedScript
+//
+// Source code and code cache data for a script compiled once per process. Each isolate that
+// executes the script instantiates it from the cache data on first use.
+//-----------------------------------------------------------------------------
+
+class V8SharedScript: public WeakRefTarget<V8SharedScript>
+{
+    PROHIBIT_COPY(V8SharedScript)
+
+public:
+
+    V8SharedScript(std::uint64_t id, const V8DocumentInfo& documentInfo, const StdString& code, std::vector<std::uint8_t>&& cacheBytes):
+        m_Id(id),
+        m_DocumentInfo(documentInfo),
+        m_Code(code),
+        m_CacheBytes(std::move(cacheBytes))
+    {
+    }
+
+    std::uint64_t GetId() const { return m_Id; }
+    const V8DocumentInfo& GetDocumentInfo() const { return m_DocumentInfo; }
+    const StdString& GetCode() const { return m_Code; }
+    const std::vector<std::uint8_t>& GetCacheBytes() const { return m_CacheBytes; }
+    size_t GetSize() const { return (m_Code.GetLength() * sizeof(wchar_t)) + m_CacheBytes.size(); }
+
+private:
+
+    std::uint64_t m_Id;
+    V8DocumentInfo m_DocumentInfo;
+    StdString m_Code;
+    std::vector<std::uint8_t> m_CacheBytes;
+};
+
+//-----------------------------------------------------------------------------
+// V8SharedScriptCacheImpl
+//
+// A process-wide registry of shared scripts, keyed by source code and bounded by a memory cap.
+// When the cap is exceeded, the least recently used entries are evicted. Evicted scripts remain
+// usable by the compiled script handles that refer to them. A cap of zero disables the cache.
+//-----------------------------------------------------------------------------
+
+class V8SharedScriptCacheImpl
+{
+    PROHIBIT_COPY(V8SharedScriptCacheImpl)
+
+public:
+
+    static V8SharedScriptCacheImpl& GetInstance();
+
+    bool IsEnabled() const { return m_MaxSize > 0; }
+    size_t GetMaxSize() const { return m_MaxSize; }
+    void SetMaxSize(size_t maxSize);
+
+    SharedPtr<V8SharedScript> Find(const StdString& code);
+    SharedPtr<V8SharedScript> Add(const V8DocumentInfo& documentInfo, const StdString& code, std::vector<std::uint8_t>&& cacheBytes);
+    void RecordInstantiation() { ++m_InstantiationCount; }
+
+    void GetStatistics(V8SharedScriptCache::Statistics& statistics);
+    void Clear();
+
+private:
+
+    struct CodeLess
+    {
+        bool operator()(const StdString* pLeft, const StdString* pRight) const { return *pLeft < *pRight; }
+    };
+
+    typedef std::list<SharedPtr<V8SharedScript>> EntryList;
+    typedef std::map<const StdString*, EntryList::iterator, CodeLess> EntryMap;
+
+    V8SharedScriptCacheImpl();
+
+    void TrimWithLock();
+
+    SimpleMutex m_Mutex;
+    EntryList m_Entries;
+    EntryMap m_EntryMap;
+    std::atomic<size_t> m_MaxSize;
+    size_t m_Size;
+    std::uint64_t m_NextId;
+    std::uint64_t m_HitCount;
+    std::uint64_t m_MissCount;
+    std::uint64_t m_EvictionCount;
+    std::atomic<std::uint64_t> m_InstantiationCount;
+
+    static V8SharedScriptCacheImpl ms_Instance;
+};
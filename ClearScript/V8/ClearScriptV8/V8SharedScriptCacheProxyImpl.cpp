@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Managed.h"
+
+namespace Microsoft {
+namespace ClearScript {
+namespace V8 {
+
+    //-------------------------------------------------------------------------
+    // V8SharedScriptCacheProxyImpl implementation
+    //-------------------------------------------------------------------------
+
+    UIntPtr V8SharedScriptCacheProxyImpl::MaxSize::get()
+    {
+        return (UIntPtr)V8SharedScriptCache::GetMaxSize();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void V8SharedScriptCacheProxyImpl::MaxSize::set(UIntPtr value)
+    {
+        V8SharedScriptCache::SetMaxSize(static_cast<size_t>(value));
+    }
+
+    //-------------------------------------------------------------------------
+
+    V8SharedScriptCacheInfo^ V8SharedScriptCacheProxyImpl::GetInfo()
+    {
+        V8SharedScriptCache::Statistics statistics;
+        V8SharedScriptCache::GetStatistics(statistics);
+
+        auto gcInfo = gcnew V8SharedScriptCacheInfo();
+        gcInfo->EntryCount = statistics.EntryCount;
+        gcInfo->Size = statistics.Size;
+        gcInfo->MaxSize = statistics.MaxSize;
+        gcInfo->HitCount = statistics.HitCount;
+        gcInfo->MissCount = statistics.MissCount;
+        gcInfo->EvictionCount = statistics.EvictionCount;
+        gcInfo->InstantiationCount = statistics.InstantiationCount;
+        return gcInfo;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void V8SharedScriptCacheProxyImpl::Clear()
+    {
+        V8SharedScriptCache::Clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    ENSURE_INTERNAL_CLASS(V8SharedScriptCacheProxyImpl)
+
+}}}
@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+namespace Microsoft {
+namespace ClearScript {
+namespace V8 {
+
+    //-------------------------------------------------------------------------
+    // V8SharedScriptCacheProxyImpl
+    //-------------------------------------------------------------------------
+
+    private ref class V8SharedScriptCacheProxyImpl : V8SharedScriptCacheProxy
+    {
+    public:
+
+        property UIntPtr MaxSize
+        {
+            virtual UIntPtr get() override;
+            virtual void set(UIntPtr value) override;
+        }
+
+        virtual V8SharedScriptCacheInfo^ GetInfo() override;
+        virtual void Clear() override;
+
+        ~V8SharedScriptCacheProxyImpl() {}
+    };
+
+}}}
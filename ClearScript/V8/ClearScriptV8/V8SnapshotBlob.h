@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8SnapshotBlob
+//-----------------------------------------------------------------------------
+
+class V8SnapshotBlob: public SharedPtrTarget
+{
+    PROHIBIT_COPY(V8SnapshotBlob)
+
+public:
+
+    V8SnapshotBlob(const char* pData, size_t size):
+        m_Data(pData, pData + size)
+    {
+    }
+
+    explicit V8SnapshotBlob(const std::vector<std::uint8_t>& bytes):
+        m_Data(bytes.begin(), bytes.end())
+    {
+    }
+
+    const char* GetData() const
+    {
+        return m_Data.data();
+    }
+
+    int GetSize() const
+    {
+        return static_cast<int>(m_Data.size());
+    }
+
+    void GetBytes(std::vector<std::uint8_t>& bytes) const
+    {
+        bytes.assign(m_Data.begin(), m_Data.end());
+    }
+
+private:
+
+    // V8 retains a pointer to the startup data for the lifetime of every isolate created from
+    // it, so the blob is immutable and shared by reference.
+
+    std::vector<char> m_Data;
+};
@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Managed.h"
+
+namespace Microsoft {
+namespace ClearScript {
+namespace V8 {
+
+    //-------------------------------------------------------------------------
+    // V8SnapshotProxyImpl implementation
+    //-------------------------------------------------------------------------
+
+    V8SnapshotProxyImpl::V8SnapshotProxyImpl(String^ gcName, String^ gcWarmUpCode):
+        m_gcLock(gcnew Object)
+    {
+        try
+        {
+            m_pspSnapshotBlob = new SharedPtr<V8SnapshotBlob>(V8Isolate::CreateSnapshotBlob(StdString(gcName), StdString(gcWarmUpCode)));
+        }
+        catch (const V8Exception& exception)
+        {
+            exception.ThrowScriptEngineException();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    V8SnapshotProxyImpl::V8SnapshotProxyImpl(array<Byte>^ gcBytes):
+        m_gcLock(gcnew Object)
+    {
+        if ((gcBytes == nullptr) || (gcBytes->Length < 1))
+        {
+            throw gcnew ArgumentException(L"Invalid V8 startup snapshot data", L"bytes");
+        }
+
+        auto length = gcBytes->Length;
+        std::vector<std::uint8_t> bytes(length);
+        Marshal::Copy(gcBytes, 0, (IntPtr)&bytes[0], length);
+
+        m_pspSnapshotBlob = new SharedPtr<V8SnapshotBlob>(new V8SnapshotBlob(bytes));
+    }
+
+    //-------------------------------------------------------------------------
+
+    array<Byte>^ V8SnapshotProxyImpl::GetBytes()
+    {
+        std::vector<std::uint8_t> bytes;
+        GetSnapshotBlob()->GetBytes(bytes);
+
+        auto length = static_cast<int>(bytes.size());
+        auto gcBytes = gcnew array<Byte>(length);
+        if (length > 0)
+        {
+            Marshal::Copy((IntPtr)&bytes[0], gcBytes, 0, length);
+        }
+
+        return gcBytes;
+    }
+
+    //-------------------------------------------------------------------------
+
+    SharedPtr<V8SnapshotBlob> V8SnapshotProxyImpl::GetSnapshotBlob()
+    {
+        BEGIN_LOCK_SCOPE(m_gcLock)
+
+            if (m_pspSnapshotBlob == nullptr)
+            {
+                throw gcnew ObjectDisposedException(ToString());
+            }
+
+            return *m_pspSnapshotBlob;
+
+        END_LOCK_SCOPE
+    }
+
+    //-------------------------------------------------------------------------
+
+    V8SnapshotProxyImpl::~V8SnapshotProxyImpl()
+    {
+        SharedPtr<V8SnapshotBlob> spSnapshotBlob;
+
+        BEGIN_LOCK_SCOPE(m_gcLock)
+
+            if (m_pspSnapshotBlob != nullptr)
+            {
+                // hold V8 snapshot blob for destruction outside lock scope
+                spSnapshotBlob = *m_pspSnapshotBlob;
+                delete m_pspSnapshotBlob;
+                m_pspSnapshotBlob = nullptr;
+            }
+
+        END_LOCK_SCOPE
+
+        if (!spSnapshotBlob.IsEmpty())
+        {
+            GC::SuppressFinalize(this);
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    V8SnapshotProxyImpl::!V8SnapshotProxyImpl()
+    {
+        if (m_pspSnapshotBlob != nullptr)
+        {
+            delete m_pspSnapshotBlob;
+            m_pspSnapshotBlob = nullptr;
+        }
+    }
+
+}}}
@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+namespace Microsoft {
+namespace ClearScript {
+namespace V8 {
+
+    //-------------------------------------------------------------------------
+    // V8SnapshotProxyImpl
+    //-------------------------------------------------------------------------
+
+    private ref class V8SnapshotProxyImpl : V8SnapshotProxy
+    {
+    public:
+
+        V8SnapshotProxyImpl(String^ gcName, String^ gcWarmUpCode);
+        V8SnapshotProxyImpl(array<Byte>^ gcBytes);
+
+        virtual array<Byte>^ GetBytes() override;
+
+        SharedPtr<V8SnapshotBlob> GetSnapshotBlob();
+
+        ~V8SnapshotProxyImpl();
+        !V8SnapshotProxyImpl();
+
+    private:
+
+        Object^ m_gcLock;
+        SharedPtr<V8SnapshotBlob>* m_pspSnapshotBlob;
+    };
+
+}}}
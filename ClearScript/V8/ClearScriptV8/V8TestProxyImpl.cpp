@@ -16,6 +16,21 @@ namespace V8 {
         auto gcCounters = gcnew V8ProxyCounters();
         gcCounters->IsolateCount = V8Isolate::GetInstanceCount();
         gcCounters->ContextCount = V8Context::GetInstanceCount();
+        gcCounters->HostTypeTemplateCount = V8Context::GetHostTypeTemplateCount();
+        gcCounters->HostPropertyFetchCount = V8Context::GetHostPropertyFetchCount();
+
+        V8Isolate::WorkerPoolStatistics statistics;
+        V8Isolate::GetWorkerPoolStatistics(statistics);
+        gcCounters->WorkerThreadCount = statistics.ThreadCount;
+        gcCounters->WorkerQueueDepth = statistics.QueueDepth;
+        gcCounters->WorkerTaskCount = statistics.TaskCount;
+        gcCounters->WorkerStealCount = statistics.StealCount;
+
+        std::uint64_t idleTaskPostedCount;
+        std::uint64_t idleTaskRunCount;
+        V8Isolate::GetIdleTaskCounts(idleTaskPostedCount, idleTaskRunCount);
+        gcCounters->IdleTaskPostedCount = idleTaskPostedCount;
+        gcCounters->IdleTaskRunCount = idleTaskRunCount;
         return gcCounters;
     }
 
@@ -0,0 +1,334 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Native.h"
+
+//-----------------------------------------------------------------------------
+// local helper functions
+//-----------------------------------------------------------------------------
+
+// The wheel has four levels of 64 slots each. With a 10 ms tick, level 0 spans 640 ms and the
+// wheel as a whole spans about 46 hours; longer delays are parked in the last slot and re-inserted
+// when it cascades.
+
+static const std::uint64_t s_TickMilliseconds = 10;
+static const size_t s_SlotBits = 6;
+static const size_t s_SlotCount = static_cast<size_t>(1) << s_SlotBits;
+static const std::uint64_t s_SlotMask = s_SlotCount - 1;
+static const size_t s_LevelCount = 4;
+static const std::uint64_t s_MaxDelayTicks = (static_cast<std::uint64_t>(1) << (s_SlotBits * s_LevelCount)) - 1;
+
+//-----------------------------------------------------------------------------
+
+static size_t GetSlotIndex(size_t level, std::uint64_t tick)
+{
+    return (level * s_SlotCount) + static_cast<size_t>((tick >> (s_SlotBits * level)) & s_SlotMask);
+}
+
+//-----------------------------------------------------------------------------
+// V8TimerWheel implementation
+//-----------------------------------------------------------------------------
+
+V8TimerWheel::V8TimerWheel():
+    m_StartTime(std::chrono::steady_clock::now()),
+    m_CurrentTick(0),
+    m_WakeTick(UINT64_MAX),
+    m_NextId(0),
+    m_Slots(s_LevelCount * s_SlotCount, nullptr),
+    m_Stopping(false),
+    m_Thread([this] { RunDriver(); })
+{
+}
+
+//-----------------------------------------------------------------------------
+
+V8TimerWheel::TimerId V8TimerWheel::Schedule(const void* pvGroup, double delayInSeconds, Callback&& callback)
+{
+    auto delayInTicks = static_cast<std::uint64_t>(1);
+    if (delayInSeconds > 0)
+    {
+        delayInTicks = static_cast<std::uint64_t>(std::ceil(std::min(delayInSeconds * 1000 / s_TickMilliseconds, 1.0e15)));
+        delayInTicks = std::max(delayInTicks, static_cast<std::uint64_t>(1));
+    }
+
+    auto notify = false;
+    TimerId id;
+
+    BEGIN_MUTEX_SCOPE(m_Mutex)
+
+        // an idle wheel has no slots to cascade; catch up with the clock without ticking
+        auto elapsedTicks = GetElapsedTicks();
+        if (m_Entries.empty())
+        {
+            m_CurrentTick = std::max(m_CurrentTick, elapsedTicks);
+        }
+
+        id = ++m_NextId;
+
+        std::unique_ptr<Entry> spEntry(new Entry);
+        spEntry->Id = id;
+        spEntry->pvGroup = pvGroup;
+        spEntry->ExpiryTick = std::max(m_CurrentTick, elapsedTicks) + delayInTicks;
+        spEntry->Func = std::move(callback);
+
+        Insert(spEntry.get());
+        m_Groups[pvGroup].insert(id);
+        notify = spEntry->ExpiryTick < m_WakeTick;
+        m_Entries.emplace(id, std::move(spEntry));
+
+    END_MUTEX_SCOPE
+
+    if (notify)
+    {
+        m_Changed.notify_one();
+    }
+
+    return id;
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8TimerWheel::Cancel(TimerId id)
+{
+    // callbacks are destroyed outside the lock; they may hold arbitrary resources
+    std::vector<std::pair<TimerId, Callback>> callbacks;
+
+    BEGIN_MUTEX_SCOPE(m_Mutex)
+
+        auto it = m_Entries.find(id);
+        if (it == m_Entries.end())
+        {
+            return false;
+        }
+
+        Remove(it->second.get(), callbacks);
+
+    END_MUTEX_SCOPE
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8TimerWheel::CancelGroup(const void* pvGroup)
+{
+    std::vector<std::pair<TimerId, Callback>> callbacks;
+
+    BEGIN_MUTEX_SCOPE(m_Mutex)
+
+        auto itGroup = m_Groups.find(pvGroup);
+        if (itGroup != m_Groups.end())
+        {
+            auto ids = std::move(itGroup->second);
+            m_Groups.erase(itGroup);
+
+            callbacks.reserve(ids.size());
+            for (auto id : ids)
+            {
+                auto it = m_Entries.find(id);
+                if (it != m_Entries.end())
+                {
+                    Remove(it->second.get(), callbacks);
+                }
+            }
+        }
+
+    END_MUTEX_SCOPE
+}
+
+//-----------------------------------------------------------------------------
+
+V8TimerWheel::~V8TimerWheel()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex.GetImpl());
+        m_Stopping = true;
+    }
+
+    m_Changed.notify_all();
+    m_Thread.join();
+}
+
+//-----------------------------------------------------------------------------
+
+std::uint64_t V8TimerWheel::GetElapsedTicks() const
+{
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_StartTime);
+    return static_cast<std::uint64_t>(elapsed.count()) / s_TickMilliseconds;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8TimerWheel::Insert(Entry* pEntry)
+{
+    auto delay = (pEntry->ExpiryTick > m_CurrentTick) ? (pEntry->ExpiryTick - m_CurrentTick) : 0;
+    auto slotTick = (delay > s_MaxDelayTicks) ? (m_CurrentTick + s_MaxDelayTicks) : std::max(pEntry->ExpiryTick, m_CurrentTick);
+
+    size_t level = 0;
+    while ((level < (s_LevelCount - 1)) && ((slotTick - m_CurrentTick) >> (s_SlotBits * (level + 1))) != 0)
+    {
+        level++;
+    }
+
+    auto slotIndex = GetSlotIndex(level, slotTick);
+    auto& pHead = m_Slots[slotIndex];
+
+    pEntry->SlotIndex = slotIndex;
+    pEntry->pPrev = nullptr;
+    pEntry->pNext = pHead;
+    if (pHead != nullptr)
+    {
+        pHead->pPrev = pEntry;
+    }
+
+    pHead = pEntry;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8TimerWheel::Unlink(Entry* pEntry)
+{
+    if (pEntry->pPrev != nullptr)
+    {
+        pEntry->pPrev->pNext = pEntry->pNext;
+    }
+    else
+    {
+        m_Slots[pEntry->SlotIndex] = pEntry->pNext;
+    }
+
+    if (pEntry->pNext != nullptr)
+    {
+        pEntry->pNext->pPrev = pEntry->pPrev;
+    }
+
+    pEntry->pPrev = pEntry->pNext = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8TimerWheel::Remove(Entry* pEntry, std::vector<std::pair<TimerId, Callback>>& callbacks)
+{
+    auto id = pEntry->Id;
+
+    Unlink(pEntry);
+    callbacks.emplace_back(id, std::move(pEntry->Func));
+
+    auto itGroup = m_Groups.find(pEntry->pvGroup);
+    if (itGroup != m_Groups.end())
+    {
+        itGroup->second.erase(id);
+        if (itGroup->second.empty())
+        {
+            m_Groups.erase(itGroup);
+        }
+    }
+
+    m_Entries.erase(id);
+}
+
+//-----------------------------------------------------------------------------
+
+void V8TimerWheel::Advance(std::uint64_t tick, std::vector<std::pair<TimerId, Callback>>& callbacks)
+{
+    while (m_CurrentTick < tick)
+    {
+        if (m_Entries.empty())
+        {
+            m_CurrentTick = tick;
+            break;
+        }
+
+        ++m_CurrentTick;
+
+        // when a level wraps, redistribute the next slot of the level above it
+        for (size_t level = 1; (level < s_LevelCount) && ((m_CurrentTick & ((static_cast<std::uint64_t>(1) << (s_SlotBits * level)) - 1)) == 0); level++)
+        {
+            Cascade(level);
+        }
+
+        auto pEntry = m_Slots[GetSlotIndex(0, m_CurrentTick)];
+        while (pEntry != nullptr)
+        {
+            auto pNext = pEntry->pNext;
+            Remove(pEntry, callbacks);
+            pEntry = pNext;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8TimerWheel::Cascade(size_t level)
+{
+    auto& pHead = m_Slots[GetSlotIndex(level, m_CurrentTick)];
+    auto pEntry = pHead;
+    pHead = nullptr;
+
+    while (pEntry != nullptr)
+    {
+        auto pNext = pEntry->pNext;
+        Insert(pEntry);
+        pEntry = pNext;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+std::uint64_t V8TimerWheel::GetNextWakeTick() const
+{
+    if (m_Entries.empty())
+    {
+        return UINT64_MAX;
+    }
+
+    // wake for the next occupied level 0 slot, or at the next cascade, whichever comes first
+
+    auto cascadeTick = (m_CurrentTick | s_SlotMask) + 1;
+    for (auto tick = m_CurrentTick + 1; tick < cascadeTick; tick++)
+    {
+        if (m_Slots[GetSlotIndex(0, tick)] != nullptr)
+        {
+            return tick;
+        }
+    }
+
+    return cascadeTick;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8TimerWheel::RunDriver()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex.GetImpl());
+    while (!m_Stopping)
+    {
+        std::vector<std::pair<TimerId, Callback>> callbacks;
+        Advance(GetElapsedTicks(), callbacks);
+
+        if (!callbacks.empty())
+        {
+            // invoke callbacks without the lock so that they can schedule or cancel timers
+            lock.unlock();
+
+            for (auto& callback : callbacks)
+            {
+                callback.second(callback.first);
+            }
+
+            callbacks.clear();
+            lock.lock();
+            continue;
+        }
+
+        m_WakeTick = GetNextWakeTick();
+        if (m_WakeTick == UINT64_MAX)
+        {
+            m_Changed.wait(lock);
+        }
+        else
+        {
+            m_Changed.wait_until(lock, m_StartTime + std::chrono::milliseconds(m_WakeTick * s_TickMilliseconds));
+        }
+    }
+}
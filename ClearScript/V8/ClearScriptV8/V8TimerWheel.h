@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8TimerWheel
+//-----------------------------------------------------------------------------
+
+class V8TimerWheel
+{
+    PROHIBIT_COPY(V8TimerWheel)
+
+public:
+
+    using TimerId = std::uint64_t;
+    using Callback = std::function<void(TimerId)>;
+
+    V8TimerWheel();
+
+    TimerId Schedule(const void* pvGroup, double delayInSeconds, Callback&& callback);
+    bool Cancel(TimerId id);
+    void CancelGroup(const void* pvGroup);
+
+    ~V8TimerWheel();
+
+private:
+
+    struct Entry
+    {
+        TimerId Id;
+        const void* pvGroup;
+        std::uint64_t ExpiryTick;
+        Callback Func;
+        Entry* pPrev;
+        Entry* pNext;
+        size_t SlotIndex;
+    };
+
+    std::uint64_t GetElapsedTicks() const;
+    void Insert(Entry* pEntry);
+    void Unlink(Entry* pEntry);
+    void Remove(Entry* pEntry, std::vector<std::pair<TimerId, Callback>>& callbacks);
+    void Advance(std::uint64_t tick, std::vector<std::pair<TimerId, Callback>>& callbacks);
+    void Cascade(size_t level);
+    std::uint64_t GetNextWakeTick() const;
+    void RunDriver();
+
+    SimpleMutex m_Mutex;
+    std::condition_variable m_Changed;
+    std::chrono::steady_clock::time_point m_StartTime;
+    std::uint64_t m_CurrentTick;
+    std::uint64_t m_WakeTick;
+    TimerId m_NextId;
+    std::vector<Entry*> m_Slots;
+    std::unordered_map<TimerId, std::unique_ptr<Entry>> m_Entries;
+    std::unordered_map<const void*, std::unordered_set<TimerId>> m_Groups;
+    bool m_Stopping;
+    std::thread m_Thread;
+};
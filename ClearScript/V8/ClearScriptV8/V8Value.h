@@ -11,6 +11,11 @@ class V8Value
 {
 public:
 
+    // Strings up to this length are stored inline, so creating, copying, and moving them
+    // requires no heap allocation.
+
+    static const int MaxInlineStringLength = 22;
+
     enum NonexistentInitializer
     {
         Nonexistent
@@ -35,6 +40,7 @@ public:
     {
         None,
         ArrayBuffer,
+        SharedArrayBuffer,
         DataView,
         Uint8Array,
         Uint8ClampedArray,
@@ -100,6 +106,22 @@ public:
         m_Data.pString = pString;
     }
 
+    V8Value(const wchar_t* pValue, int length):
+        m_Subtype(Subtype::None)
+    {
+        if (length <= MaxInlineStringLength)
+        {
+            m_Type = Type::InlineString;
+            m_Data.InlineStringValue.Length = static_cast<std::uint16_t>(length);
+            memcpy(m_Data.InlineStringValue.Chars, pValue, length * sizeof(wchar_t));
+        }
+        else
+        {
+            m_Type = Type::String;
+            m_Data.pString = new StdString(std::wstring(pValue, length));
+        }
+    }
+
     V8Value(V8ObjectHolder* pV8ObjectHolder, Subtype subtype):
         m_Type(Type::V8Object),
         m_Subtype(subtype)
@@ -204,11 +226,19 @@ public:
         return false;
     }
 
-    bool AsString(const StdString*& pString) const
+    bool AsString(const wchar_t*& pValue, int& length) const
     {
+        if (m_Type == Type::InlineString)
+        {
+            pValue = m_Data.InlineStringValue.Chars;
+            length = m_Data.InlineStringValue.Length;
+            return true;
+        }
+
         if (m_Type == Type::String)
         {
-            pString = m_Data.pString;
+            pValue = m_Data.pString->ToCString();
+            length = m_Data.pString->GetLength();
             return true;
         }
 
@@ -266,11 +296,18 @@ private:
         Int32,
         UInt32,
         String,
+        InlineString,
         V8Object,
         HostObject,
         DateTime
     };
 
+    struct InlineString
+    {
+        std::uint16_t Length;
+        wchar_t Chars[MaxInlineStringLength];
+    };
+
     union Data
     {
         bool BooleanValue;
@@ -278,6 +315,7 @@ private:
         std::int32_t Int32Value;
         std::uint32_t UInt32Value;
         const StdString* pString;
+        InlineString InlineStringValue;
         V8ObjectHolder* pV8ObjectHolder;
         HostObjectHolder* pHostObjectHolder;
     };
@@ -307,6 +345,10 @@ private:
         {
             m_Data.pString = new StdString(*that.m_Data.pString);
         }
+        else if (m_Type == Type::InlineString)
+        {
+            m_Data.InlineStringValue = that.m_Data.InlineStringValue;
+        }
         else if (m_Type == Type::V8Object)
         {
             m_Data.pV8ObjectHolder = that.m_Data.pV8ObjectHolder->Clone();
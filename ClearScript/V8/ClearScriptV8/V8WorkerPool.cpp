@@ -0,0 +1,186 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include "ClearScriptV8Native.h"
+
+//-----------------------------------------------------------------------------
+// local helper functions
+//-----------------------------------------------------------------------------
+
+static thread_local V8WorkerPool* s_pCurrentPool = nullptr;
+static thread_local size_t s_CurrentWorkerIndex = 0;
+
+//-----------------------------------------------------------------------------
+// V8WorkerPool implementation
+//-----------------------------------------------------------------------------
+
+V8WorkerPool::V8WorkerPool(size_t threadCount):
+    m_NextWorkerIndex(0),
+    m_QueueDepth(0),
+    m_TaskCount(0),
+    m_StealCount(0),
+    m_Stopping(false)
+{
+    threadCount = std::max(threadCount, static_cast<size_t>(1));
+
+    m_Workers.reserve(threadCount);
+    for (size_t index = 0; index < threadCount; index++)
+    {
+        m_Workers.push_back(std::unique_ptr<Worker>(new Worker));
+    }
+
+    for (size_t index = 0; index < threadCount; index++)
+    {
+        m_Workers[index]->Thread = std::thread([this, index] { RunWorker(index); });
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8WorkerPool::PostTask(Priority priority, Task&& task)
+{
+    // Tasks posted by a worker thread stay on that thread's deque, where they're likely to run
+    // with warm caches. Other threads distribute tasks across the pool in round-robin fashion.
+
+    auto index = (s_pCurrentPool == this) ? s_CurrentWorkerIndex : (m_NextWorkerIndex++ % m_Workers.size());
+    auto& worker = *m_Workers[index];
+
+    BEGIN_MUTEX_SCOPE(worker.Mutex)
+        worker.Queues[static_cast<size_t>(priority)].push_back(std::move(task));
+        ++m_QueueDepth;
+    END_MUTEX_SCOPE
+
+    // acquire the wait mutex to ensure that the notification isn't lost by a worker about to wait
+
+    BEGIN_MUTEX_SCOPE(m_WaitMutex)
+    END_MUTEX_SCOPE
+
+    m_TaskQueued.notify_one();
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8WorkerPool::TryGetCurrentWorkerIndex(size_t& index) const
+{
+    if (s_pCurrentPool == this)
+    {
+        index = s_CurrentWorkerIndex;
+        return true;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void V8WorkerPool::GetStatistics(size_t& queueDepth, std::uint64_t& taskCount, std::uint64_t& stealCount) const
+{
+    queueDepth = m_QueueDepth;
+    taskCount = m_TaskCount;
+    stealCount = m_StealCount;
+}
+
+//-----------------------------------------------------------------------------
+
+V8WorkerPool::~V8WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_WaitMutex.GetImpl());
+        m_Stopping = true;
+    }
+
+    m_TaskQueued.notify_all();
+
+    for (const auto& spWorker : m_Workers)
+    {
+        spWorker->Thread.join();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void V8WorkerPool::RunWorker(size_t index)
+{
+    s_pCurrentPool = this;
+    s_CurrentWorkerIndex = index;
+
+    while (true)
+    {
+        Task task;
+        if (TryTakeTask(index, task))
+        {
+            task();
+            ++m_TaskCount;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_WaitMutex.GetImpl());
+        m_TaskQueued.wait(lock, [this] { return m_Stopping || (m_QueueDepth > 0); });
+
+        if (m_Stopping)
+        {
+            break;
+        }
+    }
+
+    s_pCurrentPool = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8WorkerPool::TryTakeTask(size_t index, Task& task)
+{
+    // Priority takes precedence over locality; a worker steals a high-priority task from a peer
+    // before it runs a normal-priority task from its own deque.
+
+    auto workerCount = m_Workers.size();
+    for (size_t priorityIndex = 0; priorityIndex < static_cast<size_t>(Priority::Count); priorityIndex++)
+    {
+        if (TryPopTask(*m_Workers[index], priorityIndex, false, task))
+        {
+            return true;
+        }
+
+        for (size_t offset = 1; offset < workerCount; offset++)
+        {
+            if (TryPopTask(*m_Workers[(index + offset) % workerCount], priorityIndex, true, task))
+            {
+                ++m_StealCount;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool V8WorkerPool::TryPopTask(Worker& worker, size_t priorityIndex, bool steal, Task& task)
+{
+    // owners take their most recent task; thieves take the oldest
+
+    BEGIN_MUTEX_SCOPE(worker.Mutex)
+
+        auto& queue = worker.Queues[priorityIndex];
+        if (!queue.empty())
+        {
+            if (steal)
+            {
+                task = std::move(queue.front());
+                queue.pop_front();
+            }
+            else
+            {
+                task = std::move(queue.back());
+                queue.pop_back();
+            }
+
+            --m_QueueDepth;
+            return true;
+        }
+
+    END_MUTEX_SCOPE
+
+    return false;
+}
@@ -0,0 +1,57 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#pragma once
+
+//-----------------------------------------------------------------------------
+// V8WorkerPool
+//-----------------------------------------------------------------------------
+
+class V8WorkerPool
+{
+    PROHIBIT_COPY(V8WorkerPool)
+
+public:
+
+    // IMPORTANT: priorities are ordered from highest to lowest
+    enum class Priority
+    {
+        High,
+        Normal,
+        Count
+    };
+
+    using Task = std::function<void()>;
+
+    explicit V8WorkerPool(size_t threadCount);
+
+    size_t GetThreadCount() const { return m_Workers.size(); }
+    void PostTask(Priority priority, Task&& task);
+    bool TryGetCurrentWorkerIndex(size_t& index) const;
+    void GetStatistics(size_t& queueDepth, std::uint64_t& taskCount, std::uint64_t& stealCount) const;
+
+    ~V8WorkerPool();
+
+private:
+
+    struct Worker
+    {
+        SimpleMutex Mutex;
+        std::deque<Task> Queues[static_cast<size_t>(Priority::Count)];
+        std::thread Thread;
+    };
+
+    void RunWorker(size_t index);
+    bool TryTakeTask(size_t index, Task& task);
+    bool TryPopTask(Worker& worker, size_t priorityIndex, bool steal, Task& task);
+
+    std::vector<std::unique_ptr<Worker>> m_Workers;
+    std::atomic<size_t> m_NextWorkerIndex;
+
+    SimpleMutex m_WaitMutex;
+    std::condition_variable m_TaskQueued;
+    std::atomic<size_t> m_QueueDepth;
+    std::atomic<std::uint64_t> m_TaskCount;
+    std::atomic<std::uint64_t> m_StealCount;
+    bool m_Stopping;
+};
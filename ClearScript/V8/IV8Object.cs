@@ -12,6 +12,9 @@ namespace Microsoft.ClearScript.V8
         void SetProperty(string name, object value);
         bool DeleteProperty(string name);
         string[] GetPropertyNames();
+        object[] GetProperties(string[] names);
+        void SetProperties(string[] names, object[] values);
+        byte[] ExportGraph(int maxDepth, int maxSize);
 
         object GetProperty(int index);
         void SetProperty(int index, object value);
@@ -7,6 +7,7 @@ namespace Microsoft.ClearScript.V8
     {
         None,
         ArrayBuffer,
+        SharedArrayBuffer,
         DataView,
         Uint8Array,
         Uint8ClampedArray,
@@ -28,6 +28,15 @@ namespace Microsoft.ClearScript.V8
         /// Selects code caching. Code cache data is larger and more expensive to generate than
         /// parser cache data, but it is more effective at accelerating recompilation.
         /// </summary>
-        Code
+        Code,
+
+        /// <summary>
+        /// Selects code caching with eager compilation. All functions in the script are compiled
+        /// up front, so the code cache data also covers functions that V8 would otherwise compile
+        /// lazily on first use. Compilation is slower and the cache data is larger, but
+        /// recompilation from the cache data avoids nearly all subsequent lazy compilation. Cache
+        /// data generated with this option is consumed in the same way as <see cref="Code"/> data.
+        /// </summary>
+        EagerCode
     }
 }
@@ -2,6 +2,7 @@
 // Licensed under the MIT license.
 
 using System;
+using System.Threading.Tasks;
 
 namespace Microsoft.ClearScript.V8
 {
@@ -16,6 +17,8 @@ namespace Microsoft.ClearScript.V8
 
         public abstract TimeSpan RuntimeHeapSizeSampleInterval { get; set; }
 
+        public abstract TimeSpan RuntimeTimeSliceInterval { get; set; }
+
         public abstract UIntPtr MaxRuntimeStackUsage { get; set; }
 
         public abstract void InvokeWithLock(Action action);
@@ -34,14 +37,38 @@ namespace Microsoft.ClearScript.V8
 
         public abstract V8Script Compile(DocumentInfo documentInfo, string code, V8CacheKind cacheKind, byte[] cacheBytes, out bool cacheAccepted);
 
+        public abstract Task<V8Script> CompileAsync(DocumentInfo documentInfo, string code);
+
         public abstract object Execute(V8Script script, bool evaluate);
 
+        public abstract byte[] CreateCacheBytes(V8Script script);
+
+        public abstract object ParseJson(byte[] json);
+
+        public abstract byte[] StringifyJson(object value);
+
+        public abstract object CreatePromise(out object resolver);
+
+        public abstract void SettlePromise(object resolver, bool resolve, object value);
+
+        public abstract object CreateExternalArrayBuffer(IntPtr data, ulong size, Action release);
+
         public abstract void Interrupt();
 
         public abstract V8RuntimeHeapInfo GetRuntimeHeapInfo();
 
+        public abstract V8RuntimeHeapInfo GetRuntimeHeapInfoSnapshot();
+
         public abstract void CollectGarbage(bool exhaustive);
 
+        public abstract void NotifyIdle(TimeSpan idleTime);
+
+        public abstract void DrainMicrotasks(TimeSpan timeBudget);
+
         public abstract void OnAccessSettingsChanged();
+
+        public abstract void CaptureResetBaseline();
+
+        public abstract void Reset();
     }
 }
@@ -0,0 +1,19 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+namespace Microsoft.ClearScript.V8
+{
+    internal abstract class V8IsolateGroupProxy : V8Proxy
+    {
+        public static V8IsolateGroupProxy Create(string name, V8RuntimeConstraints constraints, int isolateCount, DocumentInfo documentInfo, string code)
+        {
+            return CreateImpl<V8IsolateGroupProxy>(name, constraints, isolateCount, documentInfo, code);
+        }
+
+        public abstract int IsolateCount { get; }
+
+        public abstract object[] Invoke(object[] records, int batchSize);
+
+        public abstract void GetStatistics(out ulong batchCount, out ulong recordCount, out ulong stealCount);
+    }
+}
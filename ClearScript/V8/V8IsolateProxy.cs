@@ -2,20 +2,23 @@
 // Licensed under the MIT license.
 
 using System;
+using System.Threading.Tasks;
 
 namespace Microsoft.ClearScript.V8
 {
     internal abstract class V8IsolateProxy : V8Proxy
     {
-        public static V8IsolateProxy Create(string name, V8RuntimeConstraints constraints, V8RuntimeFlags flags, int debugPort)
+        public static V8IsolateProxy Create(string name, V8RuntimeConstraints constraints, V8RuntimeFlags flags, int debugPort, V8SnapshotProxy snapshotProxy)
         {
-            return CreateImpl<V8IsolateProxy>(name, constraints, flags, debugPort);
+            return CreateImpl<V8IsolateProxy>(name, constraints, flags, debugPort, snapshotProxy);
         }
 
         public abstract UIntPtr MaxHeapSize { get; set; }
 
         public abstract TimeSpan HeapSizeSampleInterval { get; set; }
 
+        public abstract TimeSpan TimeSliceInterval { get; set; }
+
         public abstract UIntPtr MaxStackUsage { get; set; }
 
         public abstract void AwaitDebuggerAndPause();
@@ -26,8 +29,22 @@ namespace Microsoft.ClearScript.V8
 
         public abstract V8Script Compile(DocumentInfo documentInfo, string code, V8CacheKind cacheKind, byte[] cacheBytes, out bool cacheAccepted);
 
+        public abstract Task<V8Script> CompileAsync(DocumentInfo documentInfo, string code);
+
         public abstract V8RuntimeHeapInfo GetHeapInfo();
 
+        public abstract V8RuntimeHeapInfo GetHeapInfoSnapshot();
+
         public abstract void CollectGarbage(bool exhaustive);
+
+        public abstract void NotifyIdle(TimeSpan idleTime);
+
+        public abstract void DrainMicrotasks(TimeSpan timeBudget);
+
+        public abstract void SetCodeCacheDirectory(string directoryPath);
+
+        public abstract V8RuntimeCodeCacheInfo GetCodeCacheInfo();
+
+        public abstract ulong[] GetCallWithLockLatencyHistogram();
     }
 }
@@ -0,0 +1,159 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text;
+
+namespace Microsoft.ClearScript.V8
+{
+    internal static class V8ObjectGraph
+    {
+        public const int DefaultMaxDepth = 64;
+        public const int DefaultMaxSize = 64 * 1024 * 1024;
+
+        public static object Decode(byte[] graph)
+        {
+            var offset = 0;
+            var result = DecodeValue(graph, ref offset);
+
+            if (offset != graph.Length)
+            {
+                throw new InvalidDataException("Unexpected data after exported object graph");
+            }
+
+            return result;
+        }
+
+        private static object DecodeValue(byte[] graph, ref int offset)
+        {
+            var tag = (Tag)ReadByte(graph, ref offset);
+            switch (tag)
+            {
+                case Tag.Undefined:
+                    return Undefined.Value;
+
+                case Tag.Null:
+                    return null;
+
+                case Tag.False:
+                    return false;
+
+                case Tag.True:
+                    return true;
+
+                case Tag.Int32:
+                    return ReadInt32(graph, ref offset);
+
+                case Tag.Number:
+                    return ReadDouble(graph, ref offset);
+
+                case Tag.String:
+                    return ReadString(graph, ref offset);
+
+                case Tag.Array:
+                {
+                    var array = new object[ReadCount(graph, ref offset)];
+                    for (var index = 0; index < array.Length; index++)
+                    {
+                        array[index] = DecodeValue(graph, ref offset);
+                    }
+
+                    return array;
+                }
+
+                case Tag.Object:
+                {
+                    var count = ReadCount(graph, ref offset);
+                    var dictionary = new Dictionary<string, object>(count);
+                    for (var index = 0; index < count; index++)
+                    {
+                        var name = ReadString(graph, ref offset);
+                        dictionary[name] = DecodeValue(graph, ref offset);
+                    }
+
+                    return dictionary;
+                }
+
+                default:
+                    throw new InvalidDataException("Invalid tag in exported object graph");
+            }
+        }
+
+        private static byte ReadByte(byte[] graph, ref int offset)
+        {
+            VerifyAvailable(graph, offset, sizeof(byte));
+            return graph[offset++];
+        }
+
+        private static int ReadInt32(byte[] graph, ref int offset)
+        {
+            VerifyAvailable(graph, offset, sizeof(int));
+            var value = BitConverter.ToInt32(graph, offset);
+            offset += sizeof(int);
+            return value;
+        }
+
+        private static double ReadDouble(byte[] graph, ref int offset)
+        {
+            VerifyAvailable(graph, offset, sizeof(double));
+            var value = BitConverter.ToDouble(graph, offset);
+            offset += sizeof(double);
+            return value;
+        }
+
+        private static int ReadCount(byte[] graph, ref int offset)
+        {
+            var count = ReadInt32(graph, ref offset);
+            if (count < 0)
+            {
+                throw new InvalidDataException("Invalid element count in exported object graph");
+            }
+
+            return count;
+        }
+
+        private static string ReadString(byte[] graph, ref int offset)
+        {
+            var length = ReadCount(graph, ref offset);
+            if (length < 1)
+            {
+                return string.Empty;
+            }
+
+            var size = length * sizeof(char);
+            VerifyAvailable(graph, offset, size);
+
+            var value = Encoding.Unicode.GetString(graph, offset, size);
+            offset += size;
+            return value;
+        }
+
+        private static void VerifyAvailable(byte[] graph, int offset, int size)
+        {
+            if ((size < 0) || (offset > (graph.Length - size)))
+            {
+                throw new InvalidDataException("Truncated exported object graph");
+            }
+        }
+
+        #region Nested type: Tag
+
+        // IMPORTANT: maintain bitwise equivalence with native enum ObjectGraphTag
+        private enum Tag : byte
+        {
+            Undefined,
+            Null,
+            False,
+            True,
+            Int32,
+            Number,
+            String,
+            Array,
+            Object
+        }
+
+        #endregion
+    }
+}
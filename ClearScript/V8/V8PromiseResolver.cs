@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System.Threading;
+
+namespace Microsoft.ClearScript.V8
+{
+    /// <summary>
+    /// Settles a JavaScript promise created by the host.
+    /// </summary>
+    /// <remarks>
+    /// Instances of this class are created by
+    /// <see cref="V8ScriptEngine.CreatePromise(out V8PromiseResolver)"/>. Their methods can be
+    /// called from any thread and do not wait for the V8 runtime; the settlement is applied
+    /// when the runtime becomes available. A promise can be settled only once; subsequent
+    /// calls have no effect.
+    /// </remarks>
+    public sealed class V8PromiseResolver
+    {
+        private readonly V8ScriptEngine engine;
+        private object resolver;
+
+        internal V8PromiseResolver(V8ScriptEngine engine, object resolver)
+        {
+            this.engine = engine;
+            this.resolver = resolver;
+        }
+
+        /// <summary>
+        /// Resolves the promise with the specified value.
+        /// </summary>
+        /// <param name="value">The value with which to resolve the promise.</param>
+        public void Resolve(object value)
+        {
+            Settle(true, value);
+        }
+
+        /// <summary>
+        /// Rejects the promise with the specified reason.
+        /// </summary>
+        /// <param name="reason">The reason for rejecting the promise.</param>
+        public void Reject(object reason)
+        {
+            Settle(false, reason);
+        }
+
+        private void Settle(bool resolve, object value)
+        {
+            var tempResolver = Interlocked.Exchange(ref resolver, null);
+            if (tempResolver != null)
+            {
+                engine.SettlePromise(tempResolver, resolve, value);
+            }
+        }
+    }
+}
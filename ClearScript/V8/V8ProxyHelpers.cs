@@ -3,6 +3,7 @@
 
 using System;
 using System.Collections;
+using System.Collections.Concurrent;
 using System.Collections.Generic;
 using System.Linq;
 using System.Runtime.InteropServices;
@@ -12,6 +13,24 @@ namespace Microsoft.ClearScript.V8
 {
     internal static class V8ProxyHelpers
     {
+        private static readonly HashSet<string> objectPrototypeMemberNames = new HashSet<string>
+        {
+            "constructor",
+            "hasOwnProperty",
+            "isPrototypeOf",
+            "propertyIsEnumerable",
+            "toLocaleString",
+            "toString",
+            "valueOf",
+            "__proto__",
+            "__defineGetter__",
+            "__defineSetter__",
+            "__lookupGetter__",
+            "__lookupSetter__"
+        };
+
+        private static readonly ConcurrentDictionary<Type, bool> templateEligibilityMap = new ConcurrentDictionary<Type, bool>();
+
         #region strings
 
         public static unsafe char* AllocString(string value)
@@ -178,6 +197,39 @@ namespace Microsoft.ClearScript.V8
             return hostItem.Invocability;
         }
 
+        public static unsafe IntPtr GetHostObjectTemplateKey(void* pObject)
+        {
+            return GetHostObjectTemplateKey(GetHostObject(pObject));
+        }
+
+        public static IntPtr GetHostObjectTemplateKey(object obj)
+        {
+            // Host objects whose member set is fixed by their type can share a type-specific V8
+            // template whose property interceptor doesn't mask existing properties. Members that
+            // would be hidden by Object.prototype members disqualify the type.
+
+            var hostItem = obj as HostItem;
+            if ((hostItem == null) || !hostItem.HasSharedMemberData || (hostItem.Invocability != Invocability.None))
+            {
+                return IntPtr.Zero;
+            }
+
+            var hostObject = hostItem.Target as HostObject;
+            if ((hostObject == null) || hostObject.Type.IsCOMObject)
+            {
+                return IntPtr.Zero;
+            }
+
+            // the template key is type-wide, so the member name check is done once per type
+            var type = hostObject.Type;
+            if (!templateEligibilityMap.GetOrAdd(type, key => !hostItem.GetAllMemberNames().Any(name => objectPrototypeMemberNames.Contains(name))))
+            {
+                return IntPtr.Zero;
+            }
+
+            return type.TypeHandle.Value;
+        }
+
         public static unsafe object GetEnumeratorForHostObject(void* pObject)
         {
             return GetEnumeratorForHostObject(GetHostObject(pObject));
@@ -296,5 +348,24 @@ namespace Microsoft.ClearScript.V8
         }
 
         #endregion
+
+        #region script invocation suspension
+
+        public static unsafe void* SuspendScriptInvocations()
+        {
+            var state = V8ScriptEngine.SuspendInvocations();
+            return (state != null) ? AddRefHostObject(state) : null;
+        }
+
+        public static unsafe void ResumeScriptInvocations(void* pState)
+        {
+            if (pState != null)
+            {
+                V8ScriptEngine.ResumeInvocations(GetHostObject(pState));
+                ReleaseHostObject(pState);
+            }
+        }
+
+        #endregion
     }
 }
@@ -2,6 +2,8 @@
 // Licensed under the MIT license.
 
 using System;
+using System.Threading;
+using System.Threading.Tasks;
 using Microsoft.ClearScript.Util;
 
 namespace Microsoft.ClearScript.V8
@@ -20,6 +22,8 @@ namespace Microsoft.ClearScript.V8
         private readonly HostItemCollateral hostItemCollateral = new HostItemCollateral();
 
         private readonly V8IsolateProxy proxy;
+        private readonly int ownerThreadId;
+        private string codeCacheDirectory;
         private readonly InterlockedOneWayFlag disposedFlag = new InterlockedOneWayFlag();
 
         #endregion
@@ -142,9 +146,28 @@ namespace Microsoft.ClearScript.V8
         /// <param name="flags">A value that selects options for the operation.</param>
         /// <param name="debugPort">A TCP port on which to listen for a debugger connection.</param>
         public V8Runtime(string name, V8RuntimeConstraints constraints, V8RuntimeFlags flags, int debugPort)
+            : this(name, constraints, flags, debugPort, null)
+        {
+        }
+
+        /// <summary>
+        /// Initializes a new V8 runtime instance with the specified name, resource constraints, options, debug port, and startup snapshot.
+        /// </summary>
+        /// <param name="name">A name to associate with the instance. Currently this name is used only as a label in presentation contexts such as debugger user interfaces.</param>
+        /// <param name="constraints">Resource constraints for the instance.</param>
+        /// <param name="flags">A value that selects options for the operation.</param>
+        /// <param name="debugPort">A TCP port on which to listen for a debugger connection.</param>
+        /// <param name="startupSnapshot">A startup snapshot with which to initialize the instance, or <c>null</c> to use the default V8 heap.</param>
+        /// <remarks>
+        /// Every script engine created within a runtime that is initialized from a startup
+        /// snapshot observes the global state produced by the snapshot's warm-up script. See
+        /// <see cref="V8StartupSnapshot"/> for more information.
+        /// </remarks>
+        public V8Runtime(string name, V8RuntimeConstraints constraints, V8RuntimeFlags flags, int debugPort, V8StartupSnapshot startupSnapshot)
         {
             this.name = nameManager.GetUniqueName(name, GetType().GetRootName());
-            proxy = V8IsolateProxy.Create(this.name, constraints, flags, debugPort);
+            proxy = V8IsolateProxy.Create(this.name, constraints, flags, debugPort, (startupSnapshot != null) ? startupSnapshot.Proxy : null);
+            ownerThreadId = flags.HasFlag(V8RuntimeFlags.EnableThreadAffinity) ? Thread.CurrentThread.ManagedThreadId : 0;
         }
 
         #endregion
@@ -180,12 +203,17 @@ namespace Microsoft.ClearScript.V8
         /// can cause unrecoverable errors and process termination.
         /// </para>
         /// <para>
-        /// A V8 runtime unconditionally terminates the process when it exceeds its resource
-        /// constraints (see <see cref="V8RuntimeConstraints"/>). This property enables external
-        /// heap size monitoring that can prevent termination in some scenarios. To be effective,
-        /// it should be set to a value that is significantly lower than
-        /// <see cref="V8RuntimeConstraints.MaxOldSpaceSize"/>. Note that enabling heap size
-        /// monitoring results in slower script execution.
+        /// A V8 runtime terminates the process when it exceeds its resource constraints (see
+        /// <see cref="V8RuntimeConstraints"/>), unless script code is running, in which case it
+        /// interrupts script execution as if this limit had been exceeded. This property enables
+        /// heap size monitoring that can prevent such situations. To be effective, it should be
+        /// set to a value that is significantly lower than
+        /// <see cref="V8RuntimeConstraints.MaxOldSpaceSize"/>. The heap size is checked after
+        /// each garbage collection, so monitoring has little effect on script execution speed.
+        /// </para>
+        /// <para>
+        /// The monitored heap size includes the contents of ArrayBuffers, which are allocated
+        /// outside the V8 heap.
         /// </para>
         /// <para>
         /// Exceeding this limit causes the V8 runtime to interrupt script execution and throw an
@@ -208,11 +236,18 @@ namespace Microsoft.ClearScript.V8
         }
 
         /// <summary>
-        /// Gets or sets the minimum time interval between consecutive heap size samples.
+        /// Gets or sets the minimum time interval between consecutive heap size confirmations.
         /// </summary>
         /// <remarks>
+        /// <para>
         /// This property is effective only when heap size monitoring is enabled (see
         /// <see cref="MaxHeapSize"/>).
+        /// </para>
+        /// <para>
+        /// When a garbage collection leaves the heap over the limit, the V8 runtime performs a
+        /// full garbage collection to confirm that it is out of memory. This property limits how
+        /// often that can happen.
+        /// </para>
         /// </remarks>
         public TimeSpan HeapSizeSampleInterval
         {
@@ -229,6 +264,44 @@ namespace Microsoft.ClearScript.V8
             }
         }
 
+        /// <summary>
+        /// Gets or sets the time slice for script execution in the runtime.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// When this property is set to a positive value, a thread that has used the runtime
+        /// for at least the specified time interval yields to waiting threads when it next
+        /// releases the runtime. Instead of immediately reacquiring the runtime, it waits
+        /// until a waiting thread has taken over. Threads that share a runtime and make
+        /// repeated calls into it therefore take turns instead of one thread running to
+        /// completion while the others starve.
+        /// </para>
+        /// <para>
+        /// A long-running call also yields. When a thread has held the runtime for the
+        /// specified interval while others are waiting, script execution is interrupted at a
+        /// safe point, the runtime is handed to a waiting thread, and execution resumes once
+        /// the runtime becomes available again.
+        /// </para>
+        /// <para>
+        /// By default, this property is set to <see cref="TimeSpan.Zero"/>, and script execution
+        /// is not time-sliced. This property has no effect on thread-affine runtimes.
+        /// </para>
+        /// </remarks>
+        public TimeSpan TimeSliceInterval
+        {
+            get
+            {
+                VerifyNotDisposed();
+                return proxy.TimeSliceInterval;
+            }
+
+            set
+            {
+                VerifyNotDisposed();
+                proxy.TimeSliceInterval = value;
+            }
+        }
+
         /// <summary>
         /// Gets or sets the maximum amount by which the stack is permitted to grow during script execution.
         /// </summary>
@@ -258,6 +331,42 @@ namespace Microsoft.ClearScript.V8
             }
         }
 
+        /// <summary>
+        /// Gets or sets the directory in which the V8 runtime persists compiled code.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// When this property is set to a directory path, the V8 runtime automatically consults
+        /// and maintains an on-disk code cache whenever script code is compiled via
+        /// <see cref="Compile(string)"/> or a similar method that does not take explicit cache
+        /// data, including the corresponding methods of script engines that share the runtime.
+        /// Cache entries are memory-mapped files keyed by a hash of the script code and
+        /// the V8 version and flags, so they are safely shared by multiple V8 runtimes and
+        /// processes. Entries that V8 rejects are replaced automatically.
+        /// </para>
+        /// <para>
+        /// The directory is created if its parent directory exists. V8 runtimes with debugging
+        /// enabled bypass the code cache. Set this property to <c>null</c> to stop using the
+        /// code cache.
+        /// </para>
+        /// </remarks>
+        /// <seealso cref="GetCodeCacheInfo"/>
+        public string CodeCacheDirectory
+        {
+            get
+            {
+                VerifyNotDisposed();
+                return codeCacheDirectory;
+            }
+
+            set
+            {
+                VerifyNotDisposed();
+                proxy.SetCodeCacheDirectory(value);
+                codeCacheDirectory = value;
+            }
+        }
+
         /// <summary>
         /// Creates a new V8 script engine instance.
         /// </summary>
@@ -524,6 +633,58 @@ namespace Microsoft.ClearScript.V8
             return proxy.Compile(documentInfo, FormatCode ? MiscHelpers.FormatCode(code) : code, cacheKind, cacheBytes, out cacheAccepted);
         }
 
+        /// <summary>
+        /// Creates a compiled script asynchronously.
+        /// </summary>
+        /// <param name="code">The script code to compile.</param>
+        /// <returns>A task that produces a compiled script that can be executed by multiple V8 script engine instances.</returns>
+        /// <remarks>
+        /// Parsing and compilation take place on a background thread. The runtime is locked only
+        /// for the final step that binds the compiled code to the runtime, so other threads can
+        /// continue to execute script code in the meantime.
+        /// </remarks>
+        public Task<V8Script> CompileAsync(string code)
+        {
+            return CompileAsync(null, code);
+        }
+
+        /// <summary>
+        /// Creates a compiled script asynchronously with an associated document name.
+        /// </summary>
+        /// <param name="documentName">A document name for the compiled script. Currently this name is used only as a label in presentation contexts such as debugger user interfaces.</param>
+        /// <param name="code">The script code to compile.</param>
+        /// <returns>A task that produces a compiled script that can be executed by multiple V8 script engine instances.</returns>
+        /// <remarks>
+        /// Parsing and compilation take place on a background thread. The runtime is locked only
+        /// for the final step that binds the compiled code to the runtime, so other threads can
+        /// continue to execute script code in the meantime.
+        /// </remarks>
+        public Task<V8Script> CompileAsync(string documentName, string code)
+        {
+            return CompileAsync(new DocumentInfo(documentName), code);
+        }
+
+        /// <summary>
+        /// Creates a compiled script asynchronously with the specified document information.
+        /// </summary>
+        /// <param name="documentInfo">A structure containing information about the script document.</param>
+        /// <param name="code">The script code to compile.</param>
+        /// <returns>A task that produces a compiled script that can be executed by multiple V8 script engine instances.</returns>
+        /// <remarks>
+        /// Parsing and compilation take place on a background thread. The runtime is locked only
+        /// for the final step that binds the compiled code to the runtime, so other threads can
+        /// continue to execute script code in the meantime. Runtimes with debugging enabled
+        /// compile synchronously and return a completed task. If <see cref="CodeCacheDirectory"/>
+        /// is set, scripts that have a code cache entry are compiled synchronously from it, and
+        /// other scripts are compiled in the background and then added to the code cache.
+        /// </remarks>
+        public Task<V8Script> CompileAsync(DocumentInfo documentInfo, string code)
+        {
+            VerifyNotDisposed();
+            documentInfo.UniqueName = name + ":" + documentNameManager.GetUniqueName(documentInfo.Name, DocumentInfo.DefaultName);
+            return proxy.CompileAsync(documentInfo, FormatCode ? MiscHelpers.FormatCode(code) : code);
+        }
+
         /// <summary>
         /// Returns memory usage information.
         /// </summary>
@@ -534,6 +695,22 @@ namespace Microsoft.ClearScript.V8
             return proxy.GetHeapInfo();
         }
 
+        /// <summary>
+        /// Returns recent memory usage information without waiting for script execution.
+        /// </summary>
+        /// <returns>A <see cref="V8RuntimeHeapInfo"/> object containing recent memory usage information.</returns>
+        /// <remarks>
+        /// This method returns the information captured after the most recent full garbage
+        /// collection or <see cref="GetHeapInfo"/> call. Minor collections do not refresh it.
+        /// Unlike <see cref="GetHeapInfo"/>, it does not lock the V8 runtime, making it suitable
+        /// for frequent sampling of many runtimes.
+        /// </remarks>
+        public V8RuntimeHeapInfo GetHeapInfoSnapshot()
+        {
+            VerifyNotDisposed();
+            return proxy.GetHeapInfoSnapshot();
+        }
+
         /// <summary>
         /// Performs garbage collection.
         /// </summary>
@@ -544,6 +721,63 @@ namespace Microsoft.ClearScript.V8
             proxy.CollectGarbage(exhaustive);
         }
 
+        /// <summary>
+        /// Declares that the runtime is idle for the specified time.
+        /// </summary>
+        /// <param name="idleTime">The amount of time for which the runtime is not expected to be used.</param>
+        /// <remarks>
+        /// This method lets V8 run deferred work, such as incremental garbage collection
+        /// finalization, during an idle period rather than while executing script code. It
+        /// returns when the work is complete or the specified idle time has elapsed, whichever
+        /// comes first. The host should call it only when it has no immediate use for the
+        /// runtime, for example, between requests.
+        /// </remarks>
+        public void NotifyIdle(TimeSpan idleTime)
+        {
+            VerifyNotDisposed();
+            proxy.NotifyIdle(idleTime);
+        }
+
+        /// <summary>
+        /// Runs pending microtasks in the runtime.
+        /// </summary>
+        /// <param name="timeBudget">The approximate amount of time to spend running microtasks.</param>
+        /// <remarks>
+        /// <para>
+        /// This method works in batches. Each batch applies promise settlements requested from
+        /// other threads via <see cref="V8PromiseResolver"/> and then runs all pending promise
+        /// reactions and other microtasks. Batches continue until no work remains or the time
+        /// budget runs out. V8 runs each batch to completion, so a batch can exceed the budget,
+        /// and settlements that arrive after the budget runs out are left for a subsequent call.
+        /// </para>
+        /// <para>
+        /// Microtasks are subject to the same resource constraints and interruption as other
+        /// script code.
+        /// </para>
+        /// <para>
+        /// This method is intended for runtimes created with
+        /// <see cref="V8RuntimeFlags.EnableExplicitMicrotasks"/>, but it can be used with any runtimes.
+        /// </para>
+        /// </remarks>
+        public void DrainMicrotasks(TimeSpan timeBudget)
+        {
+            VerifyNotDisposed();
+            proxy.DrainMicrotasks(timeBudget);
+        }
+
+        /// <summary>
+        /// Returns code cache usage information.
+        /// </summary>
+        /// <returns>A <see cref="V8RuntimeCodeCacheInfo"/> object containing code cache usage information.</returns>
+        /// <remarks>
+        /// The counters are reset whenever <see cref="CodeCacheDirectory"/> is assigned.
+        /// </remarks>
+        public V8RuntimeCodeCacheInfo GetCodeCacheInfo()
+        {
+            VerifyNotDisposed();
+            return proxy.GetCodeCacheInfo();
+        }
+
         #endregion
 
         #region internal members
@@ -553,6 +787,22 @@ namespace Microsoft.ClearScript.V8
             get { return hostItemCollateral; }
         }
 
+        internal int OwnerThreadId
+        {
+            get { return ownerThreadId; }
+        }
+
+        internal static void VerifyOwnerThread(int ownerThreadId)
+        {
+            // A thread-affine isolate can only be released by its owner thread, which holds its
+            // lock for life. Tearing it down elsewhere would leak it, so that's rejected instead.
+
+            if ((ownerThreadId != 0) && (ownerThreadId != Thread.CurrentThread.ManagedThreadId))
+            {
+                throw new InvalidOperationException("The V8 runtime is thread-affine and cannot be disposed on the current thread");
+            }
+        }
+
         internal V8IsolateProxy IsolateProxy
         {
             get
@@ -581,10 +831,18 @@ namespace Microsoft.ClearScript.V8
         /// Call <c>Dispose()</c> when you are finished using the V8 runtime. <c>Dispose()</c>
         /// leaves the V8 runtime in an unusable state. After calling <c>Dispose()</c>, you must
         /// release all references to the V8 runtime so the garbage collector can reclaim the
-        /// memory that the V8 runtime was occupying.
+        /// memory that the V8 runtime was occupying. A thread-affine V8 runtime (see
+        /// <see cref="V8RuntimeFlags.EnableThreadAffinity"/>) can be disposed only on the thread
+        /// that created it.
         /// </remarks>
+        /// <exception cref="InvalidOperationException">The V8 runtime is thread-affine and the current thread is not its owner.</exception>
         public void Dispose()
         {
+            if (!disposedFlag.IsSet)
+            {
+                VerifyOwnerThread(ownerThreadId);
+            }
+
             if (disposedFlag.Set())
             {
                 proxy.Dispose();
@@ -0,0 +1,41 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+namespace Microsoft.ClearScript.V8
+{
+    /// <summary>
+    /// Contains code cache usage information for a V8 runtime.
+    /// </summary>
+    /// <seealso cref="V8Runtime.CodeCacheDirectory"/>
+    public class V8RuntimeCodeCacheInfo
+    {
+        internal V8RuntimeCodeCacheInfo()
+        {
+        }
+
+        /// <summary>
+        /// Gets the number of compilations for which a code cache entry was found.
+        /// </summary>
+        public ulong HitCount { get; internal set; }
+
+        /// <summary>
+        /// Gets the number of compilations for which no code cache entry was found.
+        /// </summary>
+        public ulong MissCount { get; internal set; }
+
+        /// <summary>
+        /// Gets the number of code cache entries that V8 accepted.
+        /// </summary>
+        public ulong AcceptedCount { get; internal set; }
+
+        /// <summary>
+        /// Gets the number of code cache entries that V8 rejected.
+        /// </summary>
+        public ulong RejectedCount { get; internal set; }
+
+        /// <summary>
+        /// Gets the number of code cache entries written to disk.
+        /// </summary>
+        public ulong StoredCount { get; internal set; }
+    }
+}
@@ -25,6 +25,24 @@ namespace Microsoft.ClearScript.V8
         /// Specifies that remote script debugging is to be enabled. This option is ignored if
         /// <see cref="EnableDebugging"/> is not specified.
         /// </summary>
-        EnableRemoteDebugging = 0x00000002
+        EnableRemoteDebugging = 0x00000002,
+
+        /// <summary>
+        /// Specifies that the V8 runtime is to be bound to the thread that creates it. Only that
+        /// thread can use the runtime and its script engines; calls from other threads are
+        /// rejected. In exchange, each call avoids the locking that otherwise serializes access
+        /// from multiple threads. A thread-affine runtime must be disposed on its owner thread;
+        /// disposing it on another thread throws an exception, and a runtime that is only
+        /// finalized is not reclaimed.
+        /// </summary>
+        EnableThreadAffinity = 0x00000004,
+
+        /// <summary>
+        /// Specifies that promise reactions and other microtasks are to run only when the host
+        /// calls <see cref="V8Runtime.DrainMicrotasks"/> or
+        /// <see cref="V8ScriptEngine.DrainMicrotasks"/>. By default, V8 runs pending microtasks
+        /// automatically whenever a call into script code completes.
+        /// </summary>
+        EnableExplicitMicrotasks = 0x00000008
     }
 }
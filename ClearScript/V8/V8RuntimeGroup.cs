@@ -0,0 +1,187 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+using System.Linq;
+using Microsoft.ClearScript.Util;
+
+namespace Microsoft.ClearScript.V8
+{
+    /// <summary>
+    /// Represents a set of V8 runtimes that apply a script function to records in parallel.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// A runtime group compiles a script that evaluates to a function and loads it into each of
+    /// its runtimes. The script is compiled once; the other runtimes consume its code cache.
+    /// <see cref="Invoke"/> splits records into batches and distributes them to worker threads,
+    /// one per runtime. Idle threads take pending batches from busy ones, so uneven per-record
+    /// costs do not leave runtimes idle.
+    /// </para>
+    /// <para>
+    /// The runtimes in a group are isolated from the host. Records and results must be
+    /// primitive values such as strings, numbers, and Boolean values. A function that returns
+    /// a script object produces <see cref="Undefined.Value"/>.
+    /// </para>
+    /// </remarks>
+    public sealed class V8RuntimeGroup : IDisposable
+    {
+        #region data
+
+        private static readonly IUniqueNameManager nameManager = new UniqueNameManager();
+
+        private readonly string name;
+        private readonly V8IsolateGroupProxy proxy;
+        private readonly InterlockedOneWayFlag disposedFlag = new InterlockedOneWayFlag();
+
+        #endregion
+
+        #region constructors
+
+        /// <summary>
+        /// Initializes a new runtime group with one V8 runtime per processor.
+        /// </summary>
+        /// <param name="code">Script code that evaluates to the function to apply to each record.</param>
+        public V8RuntimeGroup(string code)
+            : this(null, null, Environment.ProcessorCount, code)
+        {
+        }
+
+        /// <summary>
+        /// Initializes a new runtime group with the specified number of V8 runtimes.
+        /// </summary>
+        /// <param name="runtimeCount">The number of V8 runtimes and worker threads in the group.</param>
+        /// <param name="code">Script code that evaluates to the function to apply to each record.</param>
+        public V8RuntimeGroup(int runtimeCount, string code)
+            : this(null, null, runtimeCount, code)
+        {
+        }
+
+        /// <summary>
+        /// Initializes a new runtime group with the specified name, resource constraints, and number of V8 runtimes.
+        /// </summary>
+        /// <param name="name">A name to associate with the group. Currently this name is used only as a label in presentation contexts such as error messages.</param>
+        /// <param name="constraints">Resource constraints for each V8 runtime in the group.</param>
+        /// <param name="runtimeCount">The number of V8 runtimes and worker threads in the group.</param>
+        /// <param name="code">Script code that evaluates to the function to apply to each record.</param>
+        public V8RuntimeGroup(string name, V8RuntimeConstraints constraints, int runtimeCount, string code)
+        {
+            MiscHelpers.VerifyNonNullArgument(code, "code");
+            if (runtimeCount < 1)
+            {
+                throw new ArgumentOutOfRangeException("runtimeCount");
+            }
+
+            this.name = nameManager.GetUniqueName(name, GetType().GetRootName());
+
+            var documentInfo = new DocumentInfo(this.name);
+            documentInfo.UniqueName = this.name;
+
+            proxy = V8IsolateGroupProxy.Create(this.name, constraints, runtimeCount, documentInfo, code);
+        }
+
+        #endregion
+
+        #region public members
+
+        /// <summary>
+        /// Gets the name associated with the runtime group.
+        /// </summary>
+        public string Name
+        {
+            get { return name; }
+        }
+
+        /// <summary>
+        /// Gets the number of V8 runtimes in the group.
+        /// </summary>
+        public int RuntimeCount
+        {
+            get
+            {
+                VerifyNotDisposed();
+                return proxy.IsolateCount;
+            }
+        }
+
+        /// <summary>
+        /// Applies the group's script function to the specified records in parallel.
+        /// </summary>
+        /// <param name="records">The records to process. Each record is passed to the script function as its only argument.</param>
+        /// <param name="batchSize">The number of records in each unit of work.</param>
+        /// <returns>An array containing the script function's result for each record, in record order.</returns>
+        /// <remarks>
+        /// This method blocks until all records have been processed. If the script function
+        /// throws an exception, remaining batches are skipped, and the first exception is
+        /// rethrown. Small batches balance load better; large batches amortize dispatch costs.
+        /// </remarks>
+        public object[] Invoke(object[] records, int batchSize)
+        {
+            MiscHelpers.VerifyNonNullArgument(records, "records");
+            if (batchSize < 1)
+            {
+                throw new ArgumentOutOfRangeException("batchSize");
+            }
+
+            VerifyNotDisposed();
+            return proxy.Invoke(records, batchSize).Select(MarshalToHost).ToArray();
+        }
+
+        /// <summary>
+        /// Gets work distribution statistics for the runtime group.
+        /// </summary>
+        /// <param name="batchCount">On return, the total number of batches processed.</param>
+        /// <param name="recordCount">On return, the total number of records processed.</param>
+        /// <param name="stealCount">On return, the number of batches that ran on a runtime other than the one to which they were originally assigned.</param>
+        public void GetStatistics(out ulong batchCount, out ulong recordCount, out ulong stealCount)
+        {
+            VerifyNotDisposed();
+            proxy.GetStatistics(out batchCount, out recordCount, out stealCount);
+        }
+
+        #endregion
+
+        #region internal members
+
+        private static object MarshalToHost(object obj)
+        {
+            if (obj == null)
+            {
+                return Undefined.Value;
+            }
+
+            if (obj is DBNull)
+            {
+                return null;
+            }
+
+            object result;
+            return MiscHelpers.TryMarshalPrimitiveToHost(obj, out result) ? result : obj;
+        }
+
+        private void VerifyNotDisposed()
+        {
+            if (disposedFlag.IsSet)
+            {
+                throw new ObjectDisposedException(ToString());
+            }
+        }
+
+        #endregion
+
+        #region IDisposable implementation
+
+        /// <summary>
+        /// Releases all resources used by the runtime group.
+        /// </summary>
+        public void Dispose()
+        {
+            if (disposedFlag.Set())
+            {
+                proxy.Dispose();
+            }
+        }
+
+        #endregion
+    }
+}
@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT license.
 
+using System.Collections.Generic;
+
 namespace Microsoft.ClearScript.V8
 {
     /// <summary>
@@ -36,5 +38,86 @@ namespace Microsoft.ClearScript.V8
         /// Gets the heap size limit in bytes.
         /// </summary>
         public ulong HeapSizeLimit { get; internal set; }
+
+        /// <summary>
+        /// Gets the total size in bytes of the ArrayBuffer contents currently allocated by the V8
+        /// runtime.
+        /// </summary>
+        /// <remarks>
+        /// ArrayBuffer contents are allocated outside the V8 heap. They count toward
+        /// <see cref="V8Runtime.MaxHeapSize"/> nonetheless.
+        /// </remarks>
+        public ulong ArrayBufferSize { get; internal set; }
+
+        /// <summary>
+        /// Gets the largest value of <see cref="ArrayBufferSize"/> observed so far.
+        /// </summary>
+        public ulong PeakArrayBufferSize { get; internal set; }
+
+        /// <summary>
+        /// Gets the number of ArrayBuffer contents currently allocated by the V8 runtime.
+        /// </summary>
+        public ulong ArrayBufferCount { get; internal set; }
+
+        /// <summary>
+        /// Gets the total available heap size in bytes.
+        /// </summary>
+        public ulong TotalAvailableSize { get; internal set; }
+
+        /// <summary>
+        /// Gets the size in bytes of the memory that V8 currently allocates outside the heap for
+        /// its own use.
+        /// </summary>
+        public ulong MallocedMemorySize { get; internal set; }
+
+        /// <summary>
+        /// Gets the largest value of <see cref="MallocedMemorySize"/> observed so far.
+        /// </summary>
+        public ulong PeakMallocedMemorySize { get; internal set; }
+
+        /// <summary>
+        /// Gets the size in bytes of the external memory that the V8 runtime currently accounts
+        /// for.
+        /// </summary>
+        /// <remarks>
+        /// External memory is memory held alive by script objects but allocated outside the V8
+        /// heap, such as that of ArrayBuffers.
+        /// </remarks>
+        public ulong ExternalMemorySize { get; internal set; }
+
+        /// <summary>
+        /// Gets the number of script contexts currently in the heap.
+        /// </summary>
+        public ulong NativeContextCount { get; internal set; }
+
+        /// <summary>
+        /// Gets the number of script contexts that have been discarded but not yet collected.
+        /// </summary>
+        /// <remarks>
+        /// A value that remains nonzero across garbage collections usually indicates a leak.
+        /// </remarks>
+        public ulong DetachedContextCount { get; internal set; }
+
+        /// <summary>
+        /// Gets the total size in bytes of the heap memory allocated by the V8 runtime since
+        /// its creation.
+        /// </summary>
+        public ulong TotalAllocatedSize { get; internal set; }
+
+        /// <summary>
+        /// Gets the heap allocation rate, in bytes per second, since the previous sample.
+        /// </summary>
+        /// <remarks>
+        /// A sample is taken each time heap information is retrieved. Full retrievals and
+        /// snapshot retrievals are sampled separately, so each reports the rate since the
+        /// previous retrieval of the same kind. The rate is computed from the change in
+        /// <see cref="TotalAllocatedSize"/>.
+        /// </remarks>
+        public double AllocationRate { get; internal set; }
+
+        /// <summary>
+        /// Gets memory usage information for the individual spaces within the heap.
+        /// </summary>
+        public IReadOnlyList<V8RuntimeHeapSpaceInfo> SpaceInfo { get; internal set; }
     }
 }
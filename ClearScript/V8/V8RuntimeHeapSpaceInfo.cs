@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+namespace Microsoft.ClearScript.V8
+{
+    /// <summary>
+    /// Contains memory usage information for a single space within the heap of a V8 runtime.
+    /// </summary>
+    /// <seealso cref="V8RuntimeHeapInfo.SpaceInfo"/>
+    public class V8RuntimeHeapSpaceInfo
+    {
+        internal V8RuntimeHeapSpaceInfo()
+        {
+        }
+
+        /// <summary>
+        /// Gets the name of the space.
+        /// </summary>
+        /// <remarks>
+        /// Space names are defined by V8. Examples include <c>new_space</c>, <c>old_space</c>,
+        /// <c>code_space</c>, <c>map_space</c>, and <c>large_object_space</c>.
+        /// </remarks>
+        public string Name { get; internal set; }
+
+        /// <summary>
+        /// Gets the size of the space in bytes.
+        /// </summary>
+        public ulong Size { get; internal set; }
+
+        /// <summary>
+        /// Gets the used size of the space in bytes.
+        /// </summary>
+        public ulong UsedSize { get; internal set; }
+
+        /// <summary>
+        /// Gets the available size of the space in bytes.
+        /// </summary>
+        public ulong AvailableSize { get; internal set; }
+
+        /// <summary>
+        /// Gets the physical memory size of the space in bytes.
+        /// </summary>
+        public ulong PhysicalSize { get; internal set; }
+    }
+}
@@ -6,6 +6,7 @@ using System.Collections.Generic;
 using System.Diagnostics;
 using System.Linq;
 using System.Threading;
+using System.Threading.Tasks;
 using Microsoft.ClearScript.Util;
 using Microsoft.ClearScript.Windows;
 
@@ -28,12 +29,15 @@ namespace Microsoft.ClearScript.V8
         private readonly V8ScriptEngineFlags engineFlags;
         private readonly V8ContextProxy proxy;
         private readonly object script;
+        private readonly int ownerThreadId;
         private readonly InterlockedOneWayFlag disposedFlag = new InterlockedOneWayFlag();
 
         private const int continuationInterval = 2000;
         private bool inContinuationTimerScope;
         private bool awaitDebuggerAndPause;
 
+        [ThreadStatic] private static List<V8ScriptEngine> invokingEngines;
+
         private readonly HostItemCollateral hostItemCollateral;
         private readonly IUniqueNameManager documentNameManager = new UniqueFileNameManager();
         private List<string> documentNames;
@@ -203,10 +207,16 @@ namespace Microsoft.ClearScript.V8
         internal V8ScriptEngine(V8Runtime runtime, string name, V8RuntimeConstraints constraints, V8ScriptEngineFlags flags, int debugPort)
             : base((runtime != null) ? runtime.Name + ":" + name : name)
         {
-            using (var localRuntime = (runtime != null) ? null : new V8Runtime(name, constraints))
+            var runtimeFlags = flags.HasFlag(V8ScriptEngineFlags.EnableThreadAffinity) ? V8RuntimeFlags.EnableThreadAffinity : V8RuntimeFlags.None;
+            if (flags.HasFlag(V8ScriptEngineFlags.EnableExplicitMicrotasks))
+            {
+                runtimeFlags |= V8RuntimeFlags.EnableExplicitMicrotasks;
+            }
+            using (var localRuntime = (runtime != null) ? null : new V8Runtime(name, constraints, runtimeFlags))
             {
                 var activeRuntime = runtime ?? localRuntime;
                 hostItemCollateral = activeRuntime.HostItemCollateral;
+                ownerThreadId = activeRuntime.OwnerThreadId;
 
                 engineFlags = flags;
                 proxy = V8ContextProxy.Create(activeRuntime.IsolateProxy, Name, flags, debugPort);
@@ -303,12 +313,17 @@ namespace Microsoft.ClearScript.V8
         /// can cause unrecoverable errors and process termination.
         /// </para>
         /// <para>
-        /// A V8 runtime unconditionally terminates the process when it exceeds its resource
-        /// constraints (see <see cref="V8RuntimeConstraints"/>). This property enables external
-        /// heap size monitoring that can prevent termination in some scenarios. To be effective,
-        /// it should be set to a value that is significantly lower than
-        /// <see cref="V8RuntimeConstraints.MaxOldSpaceSize"/>. Note that enabling heap size
-        /// monitoring results in slower script execution.
+        /// A V8 runtime terminates the process when it exceeds its resource constraints (see
+        /// <see cref="V8RuntimeConstraints"/>), unless script code is running, in which case it
+        /// interrupts script execution as if this limit had been exceeded. This property enables
+        /// heap size monitoring that can prevent such situations. To be effective, it should be
+        /// set to a value that is significantly lower than
+        /// <see cref="V8RuntimeConstraints.MaxOldSpaceSize"/>. The heap size is checked after
+        /// each garbage collection, so monitoring has little effect on script execution speed.
+        /// </para>
+        /// <para>
+        /// The monitored heap size includes the contents of ArrayBuffers, which are allocated
+        /// outside the V8 heap.
         /// </para>
         /// <para>
         /// Exceeding this limit causes the V8 runtime to interrupt script execution and throw an
@@ -331,11 +346,18 @@ namespace Microsoft.ClearScript.V8
         }
 
         /// <summary>
-        /// Gets or sets the minimum time interval between consecutive heap size samples.
+        /// Gets or sets the minimum time interval between consecutive heap size confirmations.
         /// </summary>
         /// <remarks>
+        /// <para>
         /// This property is effective only when heap size monitoring is enabled (see
         /// <see cref="MaxRuntimeHeapSize"/>).
+        /// </para>
+        /// <para>
+        /// When a garbage collection leaves the heap over the limit, the V8 runtime performs a
+        /// full garbage collection to confirm that it is out of memory. This property limits how
+        /// often that can happen.
+        /// </para>
         /// </remarks>
         public TimeSpan RuntimeHeapSizeSampleInterval
         {
@@ -352,6 +374,44 @@ namespace Microsoft.ClearScript.V8
             }
         }
 
+        /// <summary>
+        /// Gets or sets the time slice for script execution in the V8 runtime.
+        /// </summary>
+        /// <remarks>
+        /// <para>
+        /// When this property is set to a positive value, a thread that has used the V8 runtime
+        /// for at least the specified time interval yields to waiting threads when it next
+        /// releases the V8 runtime. Instead of immediately reacquiring the V8 runtime, it waits
+        /// until a waiting thread has taken over. Threads that share a V8 runtime and make
+        /// repeated calls into it therefore take turns instead of one thread running to
+        /// completion while the others starve.
+        /// </para>
+        /// <para>
+        /// A long-running call also yields. When a thread has held the V8 runtime for the
+        /// specified interval while others are waiting, script execution is interrupted at a
+        /// safe point, the V8 runtime is handed to a waiting thread, and execution resumes once
+        /// the V8 runtime becomes available again.
+        /// </para>
+        /// <para>
+        /// By default, this property is set to <see cref="TimeSpan.Zero"/>, and script execution
+        /// is not time-sliced. This property has no effect on thread-affine runtimes.
+        /// </para>
+        /// </remarks>
+        public TimeSpan RuntimeTimeSliceInterval
+        {
+            get
+            {
+                VerifyNotDisposed();
+                return proxy.RuntimeTimeSliceInterval;
+            }
+
+            set
+            {
+                VerifyNotDisposed();
+                proxy.RuntimeTimeSliceInterval = value;
+            }
+        }
+
         /// <summary>
         /// Gets or sets the maximum amount by which the V8 runtime is permitted to grow the stack during script execution.
         /// </summary>
@@ -599,6 +659,87 @@ namespace Microsoft.ClearScript.V8
             return tempScript;
         }
 
+        /// <summary>
+        /// Generates code cache data for a compiled script in its current state.
+        /// </summary>
+        /// <param name="script">The compiled script for which to generate cache data.</param>
+        /// <returns>Cache data for accelerated recompilation, or <c>null</c> if none could be generated.</returns>
+        /// <remarks>
+        /// <para>
+        /// V8 compiles most functions lazily, when they are first called. Cache data generated at
+        /// compilation time therefore covers little more than the script's top-level code. Cache
+        /// data generated by this method after the script has run, typically following a warm-up
+        /// phase, also covers the functions that were compiled during execution.
+        /// </para>
+        /// <para>
+        /// The cache data is consumed like cache data of kind <see cref="V8CacheKind.Code"/>.
+        /// </para>
+        /// </remarks>
+        /// <seealso cref="Compile(string, V8CacheKind, byte[], out bool)"/>
+        public byte[] CreateCacheBytes(V8Script script)
+        {
+            MiscHelpers.VerifyNonNullArgument(script, "script");
+            VerifyNotDisposed();
+
+            return ScriptInvoke(() => proxy.CreateCacheBytes(script));
+        }
+
+        /// <summary>
+        /// Creates a compiled script asynchronously.
+        /// </summary>
+        /// <param name="code">The script code to compile.</param>
+        /// <returns>A task that produces a compiled script that can be executed multiple times without recompilation.</returns>
+        /// <remarks>
+        /// Parsing and compilation take place on a background thread. The script engine is locked
+        /// only for the final step that binds the compiled code to the runtime, so other threads can
+        /// continue to execute script code in the meantime.
+        /// </remarks>
+        public Task<V8Script> CompileAsync(string code)
+        {
+            return CompileAsync(null, code);
+        }
+
+        /// <summary>
+        /// Creates a compiled script asynchronously with an associated document name.
+        /// </summary>
+        /// <param name="documentName">A document name for the compiled script. Currently this name is used only as a label in presentation contexts such as debugger user interfaces.</param>
+        /// <param name="code">The script code to compile.</param>
+        /// <returns>A task that produces a compiled script that can be executed multiple times without recompilation.</returns>
+        /// <remarks>
+        /// Parsing and compilation take place on a background thread. The script engine is locked
+        /// only for the final step that binds the compiled code to the runtime, so other threads can
+        /// continue to execute script code in the meantime.
+        /// </remarks>
+        public Task<V8Script> CompileAsync(string documentName, string code)
+        {
+            return CompileAsync(new DocumentInfo(documentName), code);
+        }
+
+        /// <summary>
+        /// Creates a compiled script asynchronously with the specified document information.
+        /// </summary>
+        /// <param name="documentInfo">A structure containing information about the script document.</param>
+        /// <param name="code">The script code to compile.</param>
+        /// <returns>A task that produces a compiled script that can be executed multiple times without recompilation.</returns>
+        /// <remarks>
+        /// Parsing and compilation take place on a background thread. The script engine is locked
+        /// only for the final step that binds the compiled code to the runtime, so other threads can
+        /// continue to execute script code in the meantime. Script engines with debugging enabled
+        /// compile synchronously and return a completed task. If the runtime has a code cache
+        /// directory, scripts that have a code cache entry are compiled synchronously from it, and
+        /// other scripts are compiled in the background and then added to the code cache.
+        /// </remarks>
+        public Task<V8Script> CompileAsync(DocumentInfo documentInfo, string code)
+        {
+            VerifyNotDisposed();
+
+            return ScriptInvoke(() =>
+            {
+                documentInfo.UniqueName = documentNameManager.GetUniqueName(documentInfo.Name, DocumentInfo.DefaultName);
+                return proxy.CompileAsync(documentInfo, FormatCode ? MiscHelpers.FormatCode(code) : code);
+            });
+        }
+
         // ReSharper disable ParameterHidesMember
 
         /// <summary>
@@ -629,8 +770,115 @@ namespace Microsoft.ClearScript.V8
             Execute(script, false);
         }
 
+        /// <summary>
+        /// Evaluates script code asynchronously.
+        /// </summary>
+        /// <param name="code">The script code to evaluate.</param>
+        /// <returns>A task that represents the evaluation and produces the result value.</returns>
+        /// <remarks>
+        /// <para>
+        /// Script code runs synchronously on a thread pool thread, because V8 cannot move
+        /// running script code between threads; the calling thread is not blocked. Combine this
+        /// method with <see cref="RuntimeTimeSliceInterval"/> to let script engines that share
+        /// a runtime take turns, including in the middle of long-running script code. The
+        /// script code occupies a thread pool thread for its duration.
+        /// </para>
+        /// <para>
+        /// For information about the types of result values that script code can return, see
+        /// <see cref="ScriptEngine.Evaluate(string, bool, string)"/>.
+        /// </para>
+        /// </remarks>
+        public Task<object> EvaluateAsync(string code)
+        {
+            VerifyNotDisposed();
+            return Task.Run(() => Evaluate(code));
+        }
+
+        /// <summary>
+        /// Executes script code asynchronously.
+        /// </summary>
+        /// <param name="code">The script code to execute.</param>
+        /// <returns>A task that represents the execution.</returns>
+        /// <remarks>
+        /// This method is similar to <see cref="EvaluateAsync(string)"/> with the exception that
+        /// it does not marshal a result value to the host.
+        /// </remarks>
+        public Task ExecuteAsync(string code)
+        {
+            VerifyNotDisposed();
+            return Task.Run(() => Execute(code));
+        }
+
+        /// <summary>
+        /// Evaluates a compiled script asynchronously.
+        /// </summary>
+        /// <param name="script">The compiled script to evaluate.</param>
+        /// <returns>A task that represents the evaluation and produces the result value.</returns>
+        /// <remarks>
+        /// See <see cref="EvaluateAsync(string)"/> for details about asynchronous execution.
+        /// </remarks>
+        public Task<object> EvaluateAsync(V8Script script)
+        {
+            VerifyNotDisposed();
+            return Task.Run(() => Evaluate(script));
+        }
+
+        /// <summary>
+        /// Executes a compiled script asynchronously.
+        /// </summary>
+        /// <param name="script">The compiled script to execute.</param>
+        /// <returns>A task that represents the execution.</returns>
+        /// <remarks>
+        /// See <see cref="EvaluateAsync(string)"/> for details about asynchronous execution.
+        /// </remarks>
+        public Task ExecuteAsync(V8Script script)
+        {
+            VerifyNotDisposed();
+            return Task.Run(() => Execute(script));
+        }
+
         // ReSharper restore ParameterHidesMember
 
+        /// <summary>
+        /// Parses JSON text into a script value.
+        /// </summary>
+        /// <param name="json">The UTF-8 encoded JSON text to parse.</param>
+        /// <returns>The parsed value.</returns>
+        /// <remarks>
+        /// <para>
+        /// The JSON text is parsed directly by the script engine without intermediate string
+        /// conversion. Objects and arrays in the result are script objects; use
+        /// <see cref="ExportGraph(ScriptObject)"/> to copy them to the host in a single operation.
+        /// </para>
+        /// <para>
+        /// For information about the types of result values that script code can return, see
+        /// <see cref="ScriptEngine.Evaluate(string, bool, string)"/>.
+        /// </para>
+        /// </remarks>
+        public object ParseJson(byte[] json)
+        {
+            MiscHelpers.VerifyNonNullArgument(json, "json");
+            VerifyNotDisposed();
+
+            return MarshalToHost(ScriptInvoke(() => proxy.ParseJson(json)), false);
+        }
+
+        /// <summary>
+        /// Converts a value to JSON text.
+        /// </summary>
+        /// <param name="value">The value to convert.</param>
+        /// <returns>The UTF-8 encoded JSON representation of <paramref name="value"/>.</returns>
+        /// <remarks>
+        /// The conversion is performed by the script engine's built-in JSON serializer, and the
+        /// result is encoded directly into UTF-8 without intermediate string conversion. The value
+        /// is serialized as if by the script function <c>JSON.stringify</c>.
+        /// </remarks>
+        public byte[] StringifyJson(object value)
+        {
+            VerifyNotDisposed();
+            return ScriptInvoke(() => proxy.StringifyJson(MarshalToScript(value)));
+        }
+
         /// <summary>
         /// Returns memory usage information for the V8 runtime.
         /// </summary>
@@ -641,6 +889,178 @@ namespace Microsoft.ClearScript.V8
             return proxy.GetRuntimeHeapInfo();
         }
 
+        /// <summary>
+        /// Returns recent memory usage information for the V8 runtime without waiting for script execution.
+        /// </summary>
+        /// <returns>A <see cref="V8RuntimeHeapInfo"/> object containing recent memory usage information for the V8 runtime.</returns>
+        /// <remarks>
+        /// This method returns the information captured after the most recent full garbage
+        /// collection or <see cref="GetRuntimeHeapInfo"/> call. Minor collections do not refresh
+        /// it. Unlike <see cref="GetRuntimeHeapInfo"/>, it does not lock the V8 runtime, making it
+        /// suitable for frequent sampling of many script engines.
+        /// </remarks>
+        public V8RuntimeHeapInfo GetRuntimeHeapInfoSnapshot()
+        {
+            VerifyNotDisposed();
+            return proxy.GetRuntimeHeapInfoSnapshot();
+        }
+
+        /// <summary>
+        /// Declares that the V8 runtime is idle for the specified time.
+        /// </summary>
+        /// <param name="idleTime">The amount of time for which the V8 runtime is not expected to be used.</param>
+        /// <remarks>
+        /// This method lets V8 run deferred work, such as incremental garbage collection
+        /// finalization, during an idle period rather than while executing script code. It
+        /// returns when the work is complete or the specified idle time has elapsed, whichever
+        /// comes first. The host should call it only when it has no immediate use for the
+        /// script engine, for example, between requests.
+        /// </remarks>
+        public void NotifyIdle(TimeSpan idleTime)
+        {
+            VerifyNotDisposed();
+            proxy.NotifyIdle(idleTime);
+        }
+
+        /// <summary>
+        /// Runs pending microtasks in the V8 runtime.
+        /// </summary>
+        /// <param name="timeBudget">The approximate amount of time to spend running microtasks.</param>
+        /// <remarks>
+        /// <para>
+        /// This method works in batches. Each batch applies promise settlements requested from
+        /// other threads via <see cref="V8PromiseResolver"/> and then runs all pending promise
+        /// reactions and other microtasks. Batches continue until no work remains or the time
+        /// budget runs out. V8 runs each batch to completion, so a batch can exceed the budget,
+        /// and settlements that arrive after the budget runs out are left for a subsequent call.
+        /// </para>
+        /// <para>
+        /// Microtasks are subject to the same resource constraints and interruption as other
+        /// script code.
+        /// </para>
+        /// <para>
+        /// This method is intended for script engines created with
+        /// <see cref="V8ScriptEngineFlags.EnableExplicitMicrotasks"/>, but it can be used with any script engines.
+        /// </para>
+        /// </remarks>
+        public void DrainMicrotasks(TimeSpan timeBudget)
+        {
+            VerifyNotDisposed();
+            proxy.DrainMicrotasks(timeBudget);
+        }
+
+        /// <summary>
+        /// Creates a JavaScript promise that the host can settle from any thread.
+        /// </summary>
+        /// <param name="resolver">On return, an object that resolves or rejects the promise.</param>
+        /// <returns>The new promise.</returns>
+        /// <remarks>
+        /// The promise can be passed to script code, which can then await it while the host
+        /// performs asynchronous work. When the work is complete, the host settles the promise
+        /// via <paramref name="resolver"/>; the call does not wait for the V8 runtime.
+        /// </remarks>
+        public object CreatePromise(out V8PromiseResolver resolver)
+        {
+            VerifyNotDisposed();
+
+            object tempResolver = null;
+            var promise = MarshalToHost(ScriptInvoke(() => proxy.CreatePromise(out tempResolver)), false);
+
+            resolver = new V8PromiseResolver(this, tempResolver);
+            return promise;
+        }
+
+        /// <summary>
+        /// Creates a JavaScript <c>ArrayBuffer</c> that uses host memory in place.
+        /// </summary>
+        /// <param name="data">A pointer to the host memory block.</param>
+        /// <param name="size">The size of the host memory block in bytes.</param>
+        /// <param name="release">An optional delegate to be invoked when the memory block is no longer in use.</param>
+        /// <returns>The new <c>ArrayBuffer</c>.</returns>
+        /// <remarks>
+        /// <para>
+        /// The <c>ArrayBuffer</c> is backed directly by the specified memory block; no data is
+        /// copied in either direction, and changes made by script code are immediately visible to
+        /// the host. This makes it possible to pass large payloads such as memory-mapped file
+        /// views to script code without copying them.
+        /// </para>
+        /// <para>
+        /// The memory block must remain valid until <paramref name="release"/> is invoked. The
+        /// V8 runtime invokes it asynchronously, on a thread pool thread, once the
+        /// <c>ArrayBuffer</c> has been garbage-collected or the runtime has been disposed. The
+        /// memory block does not count toward the runtime's heap size.
+        /// </para>
+        /// </remarks>
+        /// <seealso cref="Microsoft.ClearScript.JavaScript.IArrayBuffer.InvokeWithDirectAccess"/>
+        public object CreateExternalArrayBuffer(IntPtr data, ulong size, Action release)
+        {
+            if ((data == IntPtr.Zero) && (size > 0))
+            {
+                throw new ArgumentNullException("data");
+            }
+
+            VerifyNotDisposed();
+            return MarshalToHost(ScriptInvoke(() => proxy.CreateExternalArrayBuffer(data, size, release)), false);
+        }
+
+        /// <summary>
+        /// Copies a script object graph to the host in a single operation.
+        /// </summary>
+        /// <param name="obj">The script object or array at the root of the graph.</param>
+        /// <returns>A host copy of the object graph.</returns>
+        /// <remarks>
+        /// <para>
+        /// The graph is walked and serialized within the script engine, and the result is decoded
+        /// by the host in one pass. This is considerably faster than accessing the graph property
+        /// by property via <see cref="ScriptObject"/> instances.
+        /// </para>
+        /// <para>
+        /// Script arrays are copied to <c>object[]</c> instances, and other script objects are
+        /// copied to <c>Dictionary&lt;string, object&gt;</c> instances containing their own
+        /// enumerable properties. Only primitive values, arrays, and plain data objects can be
+        /// copied. Cyclic graphs and graphs that contain functions, host objects, or other
+        /// special objects are rejected.
+        /// </para>
+        /// </remarks>
+        public object ExportGraph(ScriptObject obj)
+        {
+            return ExportGraph(obj, V8ObjectGraph.DefaultMaxDepth, V8ObjectGraph.DefaultMaxSize);
+        }
+
+        /// <summary>
+        /// Copies a script object graph to the host in a single operation, subject to the specified limits.
+        /// </summary>
+        /// <param name="obj">The script object or array at the root of the graph.</param>
+        /// <param name="maxDepth">The maximum object nesting depth, including the root object.</param>
+        /// <param name="maxSize">The maximum size, in bytes, of the serialized graph.</param>
+        /// <returns>A host copy of the object graph.</returns>
+        /// <remarks>
+        /// See <see cref="ExportGraph(ScriptObject)"/> for more information.
+        /// </remarks>
+        public object ExportGraph(ScriptObject obj, int maxDepth, int maxSize)
+        {
+            MiscHelpers.VerifyNonNullArgument(obj, "obj");
+            VerifyNotDisposed();
+
+            var scriptItem = obj as V8ScriptItem;
+            if ((scriptItem == null) || (scriptItem.Engine != this))
+            {
+                throw new ArgumentException("The object does not belong to this script engine", "obj");
+            }
+
+            if (maxDepth < 1)
+            {
+                throw new ArgumentOutOfRangeException("maxDepth");
+            }
+
+            if (maxSize < 1)
+            {
+                throw new ArgumentOutOfRangeException("maxSize");
+            }
+
+            return scriptItem.ExportGraph(maxDepth, maxSize);
+        }
+
         #endregion
 
         #region internal members
@@ -650,6 +1070,63 @@ namespace Microsoft.ClearScript.V8
             return MarshalToHost(ScriptInvoke(() => proxy.GetRootItem()), false);
         }
 
+        internal void CaptureResetBaseline()
+        {
+            VerifyNotDisposed();
+            ScriptInvoke(() => proxy.CaptureResetBaseline());
+        }
+
+        internal void Reset()
+        {
+            VerifyNotDisposed();
+            ScriptInvoke(() => proxy.Reset());
+        }
+
+        internal void SettlePromise(object resolver, bool resolve, object value)
+        {
+            // the settlement is queued for the runtime; it must not wait for the runtime lock
+            VerifyNotDisposed();
+            proxy.SettlePromise(resolver, resolve, MarshalToScript(value));
+        }
+
+        internal static object SuspendInvocations()
+        {
+            // A time-sliced runtime can suspend this thread in the middle of script execution and
+            // let another thread enter the same script engines. The invocation state of every
+            // engine this thread is running is set aside so that the other thread starts clean.
+
+            var engines = invokingEngines;
+            if ((engines == null) || (engines.Count < 1))
+            {
+                return null;
+            }
+
+            var states = new InvocationState[engines.Count];
+            for (var index = 0; index < engines.Count; index++)
+            {
+                states[index] = new InvocationState(engines[index]);
+            }
+
+            return states;
+        }
+
+        internal static void ResumeInvocations(object state)
+        {
+            // an engine invoked reentrantly appears more than once; its first entry holds its state
+            var states = (InvocationState[])state;
+            for (var index = states.Length - 1; index >= 0; index--)
+            {
+                states[index].Restore();
+            }
+        }
+
+        private List<V8ScriptEngine> EnterInvocation()
+        {
+            var engines = invokingEngines ?? (invokingEngines = new List<V8ScriptEngine>());
+            engines.Add(this);
+            return engines;
+        }
+
         private void VerifyNotDisposed()
         {
             if (disposedFlag.IsSet)
@@ -902,6 +1379,13 @@ namespace Microsoft.ClearScript.V8
                 {
                     return scriptItem.Unwrap();
                 }
+
+                // a SharedArrayBuffer from another V8 script engine shares its memory with this one
+                var v8ScriptItem = scriptItem as V8ScriptItem;
+                if ((v8ScriptItem != null) && v8ScriptItem.IsSharedArrayBuffer)
+                {
+                    return scriptItem.Unwrap();
+                }
             }
 
             return HostItem.Wrap(this, hostTarget ?? obj, flags);
@@ -1014,7 +1498,18 @@ namespace Microsoft.ClearScript.V8
             VerifyNotDisposed();
             using (CreateEngineScope())
             {
-                proxy.InvokeWithLock(() => ScriptInvokeInternal(action));
+                proxy.InvokeWithLock(() =>
+                {
+                    var engines = EnterInvocation();
+                    try
+                    {
+                        ScriptInvokeInternal(action);
+                    }
+                    finally
+                    {
+                        engines.RemoveAt(engines.Count - 1);
+                    }
+                });
             }
         }
 
@@ -1024,7 +1519,19 @@ namespace Microsoft.ClearScript.V8
             using (CreateEngineScope())
             {
                 var result = default(T);
-                proxy.InvokeWithLock(() => result = ScriptInvokeInternal(func));
+                proxy.InvokeWithLock(() =>
+                {
+                    var engines = EnterInvocation();
+                    try
+                    {
+                        result = ScriptInvokeInternal(func);
+                    }
+                    finally
+                    {
+                        engines.RemoveAt(engines.Count - 1);
+                    }
+                });
+
                 return result;
             }
         }
@@ -1043,10 +1550,18 @@ namespace Microsoft.ClearScript.V8
         /// <see cref="ScriptEngine.Dispose()"/> invokes the protected <c>Dispose(Boolean)</c>
         /// method with the <paramref name="disposing"/> parameter set to <c>true</c>.
         /// <see cref="ScriptEngine.Finalize">Finalize</see> invokes <c>Dispose(Boolean)</c> with
-        /// <paramref name="disposing"/> set to <c>false</c>.
+        /// <paramref name="disposing"/> set to <c>false</c>. A thread-affine script engine (see
+        /// <see cref="V8ScriptEngineFlags.EnableThreadAffinity"/>) can be disposed only on the
+        /// thread that created it.
         /// </remarks>
+        /// <exception cref="InvalidOperationException">The script engine is thread-affine and the current thread is not its owner.</exception>
         protected override void Dispose(bool disposing)
         {
+            if (disposing && !disposedFlag.IsSet)
+            {
+                V8Runtime.VerifyOwnerThread(ownerThreadId);
+            }
+
             if (disposedFlag.Set())
             {
                 if (disposing)
@@ -1073,5 +1588,32 @@ namespace Microsoft.ClearScript.V8
 
         #endregion
 
+        #region Nested type: InvocationState
+
+        private sealed class InvocationState
+        {
+            private readonly V8ScriptEngine engine;
+            private readonly ScriptFrame scriptFrame;
+            private readonly bool inContinuationTimerScope;
+
+            public InvocationState(V8ScriptEngine engine)
+            {
+                this.engine = engine;
+                scriptFrame = engine.CurrentScriptFrame;
+                inContinuationTimerScope = engine.inContinuationTimerScope;
+
+                engine.CurrentScriptFrame = null;
+                engine.inContinuationTimerScope = false;
+            }
+
+            public void Restore()
+            {
+                engine.CurrentScriptFrame = scriptFrame;
+                engine.inContinuationTimerScope = inContinuationTimerScope;
+            }
+        }
+
+        #endregion
+
     }
 }
@@ -48,6 +48,22 @@ namespace Microsoft.ClearScript.V8
         /// JavaScript <c>Date</c> object always represents a Coordinated Universal Time (UTC) and
         /// has its <see cref="DateTime.Kind"/> property set to <see cref="DateTimeKind.Utc"/>.
         /// </summary>
-        EnableDateTimeConversion = 0x00000010
+        EnableDateTimeConversion = 0x00000010,
+
+        /// <summary>
+        /// Specifies that the V8 runtime created for the script engine is to be bound to the
+        /// thread that creates it. This option is ignored if the script engine is created within
+        /// an existing runtime. See <see cref="V8RuntimeFlags.EnableThreadAffinity"/> for more
+        /// information.
+        /// </summary>
+        EnableThreadAffinity = 0x00000020,
+
+        /// <summary>
+        /// Specifies that the V8 runtime created for the script engine is to run microtasks only
+        /// on request. This option is ignored if the script engine is created within an existing
+        /// runtime. See <see cref="V8RuntimeFlags.EnableExplicitMicrotasks"/> for more
+        /// information.
+        /// </summary>
+        EnableExplicitMicrotasks = 0x00000040
     }
 }
@@ -0,0 +1,490 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using Microsoft.ClearScript.Util;
+
+namespace Microsoft.ClearScript.V8
+{
+    /// <summary>
+    /// Represents a pool of pre-initialized V8 script engines.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// Creating a V8 script engine is expensive, as it requires a new V8 runtime and a fully
+    /// initialized script context. A pool amortizes that cost by keeping warm script engines,
+    /// each with a private V8 runtime, ready for immediate use.
+    /// </para>
+    /// <para>
+    /// A script engine obtained via <see cref="Rent"/> must be returned via
+    /// <see cref="Return"/> rather than disposed. Upon return, the script engine's global state
+    /// is reset: host objects and types exposed via
+    /// <see cref="ScriptEngine.AddHostObject(string, object)"/> and similar methods are removed,
+    /// script objects can no longer reach host objects they previously acquired, and global
+    /// properties created by script code are deleted or, if they cannot be deleted, set to
+    /// <c>undefined</c>. Top-level <c>let</c>, <c>const</c>, and <c>class</c> declarations are
+    /// not properties of the global object and survive the reset; hosts that rely on them should
+    /// wrap script code in a function or module scope. Script engine properties such as
+    /// <see cref="ScriptEngine.AccessContext"/> are not reset.
+    /// </para>
+    /// </remarks>
+    public sealed class V8ScriptEnginePool : IDisposable
+    {
+        #region data
+
+        private readonly string name;
+        private readonly V8RuntimeConstraints constraints;
+        private readonly V8RuntimeFlags runtimeFlags;
+        private readonly V8ScriptEngineFlags engineFlags;
+        private readonly V8StartupSnapshot startupSnapshot;
+
+        private readonly object dataLock = new object();
+        private readonly Stack<Entry> idleEntries = new Stack<Entry>();
+        private readonly Dictionary<V8ScriptEngine, Entry> activeEntries = new Dictionary<V8ScriptEngine, Entry>();
+        private int minIdleCount;
+        private int maxIdleCount;
+        private TimeSpan maxAge = Timeout.InfiniteTimeSpan;
+        private int peakActiveCount;
+        private int pendingCount;
+
+        private readonly InterlockedOneWayFlag disposedFlag = new InterlockedOneWayFlag();
+
+        #endregion
+
+        #region constructors
+
+        /// <summary>
+        /// Initializes a new V8 script engine pool with the specified size.
+        /// </summary>
+        /// <param name="size">The number of script engines to create immediately and to keep ready for use.</param>
+        public V8ScriptEnginePool(int size)
+            : this(null, null, V8RuntimeFlags.None, V8ScriptEngineFlags.None, null, size)
+        {
+        }
+
+        /// <summary>
+        /// Initializes a new V8 script engine pool with the specified name, resource constraints, options, startup snapshot, and size.
+        /// </summary>
+        /// <param name="name">A name to associate with the pooled V8 runtimes. Currently this name is used only as a label in presentation contexts such as debugger user interfaces.</param>
+        /// <param name="constraints">Resource constraints for each pooled V8 runtime.</param>
+        /// <param name="runtimeFlags">A value that selects options for each pooled V8 runtime.</param>
+        /// <param name="engineFlags">A value that selects options for each pooled script engine.</param>
+        /// <param name="startupSnapshot">A startup snapshot with which to initialize each pooled V8 runtime, or <c>null</c> to use the default V8 heap.</param>
+        /// <param name="size">The number of script engines to create immediately and to keep ready for use.</param>
+        /// <remarks>
+        /// The pool does not take ownership of <paramref name="startupSnapshot"/>, which must
+        /// remain undisposed for the lifetime of the pool.
+        /// </remarks>
+        public V8ScriptEnginePool(string name, V8RuntimeConstraints constraints, V8RuntimeFlags runtimeFlags, V8ScriptEngineFlags engineFlags, V8StartupSnapshot startupSnapshot, int size)
+        {
+            if (size < 0)
+            {
+                throw new ArgumentOutOfRangeException("size");
+            }
+
+            this.name = name;
+            this.constraints = constraints;
+            this.runtimeFlags = runtimeFlags;
+            this.engineFlags = engineFlags;
+            this.startupSnapshot = startupSnapshot;
+
+            minIdleCount = size;
+            maxIdleCount = size;
+
+            for (var index = 0; index < size; index++)
+            {
+                idleEntries.Push(CreateEntry());
+            }
+        }
+
+        #endregion
+
+        #region public members
+
+        /// <summary>
+        /// Gets or sets the number of idle script engines that the pool attempts to keep ready for use.
+        /// </summary>
+        /// <remarks>
+        /// When the number of idle script engines falls below this value, the pool creates
+        /// replacements on a background thread.
+        /// </remarks>
+        public int MinIdleCount
+        {
+            get
+            {
+                lock (dataLock)
+                {
+                    return minIdleCount;
+                }
+            }
+
+            set
+            {
+                if (value < 0)
+                {
+                    throw new ArgumentOutOfRangeException("value");
+                }
+
+                lock (dataLock)
+                {
+                    minIdleCount = value;
+                    maxIdleCount = Math.Max(maxIdleCount, value);
+                }
+
+                Replenish();
+            }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of idle script engines that the pool retains.
+        /// </summary>
+        /// <remarks>
+        /// Script engines returned to a pool that already holds this many idle script engines are
+        /// disposed along with their V8 runtimes.
+        /// </remarks>
+        public int MaxIdleCount
+        {
+            get
+            {
+                lock (dataLock)
+                {
+                    return maxIdleCount;
+                }
+            }
+
+            set
+            {
+                if (value < 0)
+                {
+                    throw new ArgumentOutOfRangeException("value");
+                }
+
+                List<Entry> excessEntries = null;
+
+                lock (dataLock)
+                {
+                    maxIdleCount = value;
+                    minIdleCount = Math.Min(minIdleCount, value);
+
+                    while (idleEntries.Count > maxIdleCount)
+                    {
+                        (excessEntries ?? (excessEntries = new List<Entry>())).Add(idleEntries.Pop());
+                    }
+                }
+
+                DisposeEntries(excessEntries);
+            }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum lifetime of a pooled script engine.
+        /// </summary>
+        /// <remarks>
+        /// Script engines that exceed this lifetime are recycled rather than returned to the
+        /// idle pool, which bounds heap growth and fragmentation in long-lived V8 runtimes. The
+        /// default value is <see cref="Timeout.InfiniteTimeSpan"/>.
+        /// </remarks>
+        public TimeSpan MaxAge
+        {
+            get
+            {
+                lock (dataLock)
+                {
+                    return maxAge;
+                }
+            }
+
+            set
+            {
+                if ((value <= TimeSpan.Zero) && (value != Timeout.InfiniteTimeSpan))
+                {
+                    throw new ArgumentOutOfRangeException("value");
+                }
+
+                lock (dataLock)
+                {
+                    maxAge = value;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets the number of idle script engines in the pool.
+        /// </summary>
+        public int IdleCount
+        {
+            get
+            {
+                lock (dataLock)
+                {
+                    return idleEntries.Count;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets the number of script engines currently rented from the pool.
+        /// </summary>
+        public int ActiveCount
+        {
+            get
+            {
+                lock (dataLock)
+                {
+                    return activeEntries.Count;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets the largest number of script engines simultaneously rented from the pool.
+        /// </summary>
+        public int PeakActiveCount
+        {
+            get
+            {
+                lock (dataLock)
+                {
+                    return peakActiveCount;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Obtains a script engine from the pool.
+        /// </summary>
+        /// <returns>A ready-to-use script engine.</returns>
+        /// <remarks>
+        /// If the pool has no idle script engines, a new one is created synchronously.
+        /// </remarks>
+        public V8ScriptEngine Rent()
+        {
+            VerifyNotDisposed();
+
+            Entry entry = null;
+            List<Entry> expiredEntries = null;
+
+            lock (dataLock)
+            {
+                while (idleEntries.Count > 0)
+                {
+                    var idleEntry = idleEntries.Pop();
+                    if (!idleEntry.IsExpired(maxAge))
+                    {
+                        entry = idleEntry;
+                        break;
+                    }
+
+                    (expiredEntries ?? (expiredEntries = new List<Entry>())).Add(idleEntry);
+                }
+            }
+
+            DisposeEntries(expiredEntries);
+
+            if (entry == null)
+            {
+                entry = CreateEntry();
+            }
+
+            lock (dataLock)
+            {
+                activeEntries.Add(entry.Engine, entry);
+                peakActiveCount = Math.Max(peakActiveCount, activeEntries.Count);
+            }
+
+            Replenish();
+            return entry.Engine;
+        }
+
+        /// <summary>
+        /// Returns a script engine to the pool.
+        /// </summary>
+        /// <param name="engine">A script engine previously obtained via <see cref="Rent"/>.</param>
+        /// <remarks>
+        /// The caller must not use the script engine after returning it to the pool.
+        /// </remarks>
+        public void Return(V8ScriptEngine engine)
+        {
+            MiscHelpers.VerifyNonNullArgument(engine, "engine");
+
+            Entry entry;
+            TimeSpan currentMaxAge;
+
+            lock (dataLock)
+            {
+                if (!activeEntries.TryGetValue(engine, out entry))
+                {
+                    throw new ArgumentException("The script engine was not obtained from this pool", "engine");
+                }
+
+                activeEntries.Remove(engine);
+                currentMaxAge = maxAge;
+            }
+
+            if (!disposedFlag.IsSet && !entry.IsExpired(currentMaxAge) && entry.TryReset())
+            {
+                lock (dataLock)
+                {
+                    if (!disposedFlag.IsSet && (idleEntries.Count < maxIdleCount))
+                    {
+                        idleEntries.Push(entry);
+                        return;
+                    }
+                }
+            }
+
+            entry.Dispose();
+            Replenish();
+        }
+
+        #endregion
+
+        #region internal members
+
+        private Entry CreateEntry()
+        {
+            var runtime = new V8Runtime(name, constraints, runtimeFlags, 0, startupSnapshot);
+            try
+            {
+                var engine = runtime.CreateScriptEngine(engineFlags);
+                engine.CaptureResetBaseline();
+                return new Entry(runtime, engine);
+            }
+            catch (Exception)
+            {
+                runtime.Dispose();
+                throw;
+            }
+        }
+
+        private void Replenish()
+        {
+            int count;
+
+            lock (dataLock)
+            {
+                if (disposedFlag.IsSet)
+                {
+                    return;
+                }
+
+                count = minIdleCount - (idleEntries.Count + pendingCount);
+                if (count < 1)
+                {
+                    return;
+                }
+
+                pendingCount += count;
+            }
+
+            ThreadPool.QueueUserWorkItem(state =>
+            {
+                for (var index = 0; index < count; index++)
+                {
+                    // a failed replacement is retried on the next rent or return
+                    Entry entry;
+                    MiscHelpers.Try(out entry, CreateEntry);
+
+                    lock (dataLock)
+                    {
+                        --pendingCount;
+                        if ((entry != null) && !disposedFlag.IsSet && (idleEntries.Count < maxIdleCount))
+                        {
+                            idleEntries.Push(entry);
+                            entry = null;
+                        }
+                    }
+
+                    if (entry != null)
+                    {
+                        entry.Dispose();
+                    }
+                }
+            });
+        }
+
+        private static void DisposeEntries(IEnumerable<Entry> entries)
+        {
+            if (entries != null)
+            {
+                foreach (var entry in entries)
+                {
+                    entry.Dispose();
+                }
+            }
+        }
+
+        private void VerifyNotDisposed()
+        {
+            if (disposedFlag.IsSet)
+            {
+                throw new ObjectDisposedException(ToString());
+            }
+        }
+
+        #endregion
+
+        #region IDisposable implementation
+
+        /// <summary>
+        /// Releases all resources used by the script engine pool.
+        /// </summary>
+        /// <remarks>
+        /// Idle script engines are disposed immediately. Script engines that are currently rented
+        /// are disposed when they are returned to the pool.
+        /// </remarks>
+        public void Dispose()
+        {
+            if (disposedFlag.Set())
+            {
+                List<Entry> entries;
+
+                lock (dataLock)
+                {
+                    entries = new List<Entry>(idleEntries);
+                    idleEntries.Clear();
+                }
+
+                DisposeEntries(entries);
+            }
+        }
+
+        #endregion
+
+        #region Nested type: Entry
+
+        private sealed class Entry : IDisposable
+        {
+            private readonly V8Runtime runtime;
+            private readonly DateTime creationTime = DateTime.UtcNow;
+
+            public Entry(V8Runtime runtime, V8ScriptEngine engine)
+            {
+                this.runtime = runtime;
+                Engine = engine;
+            }
+
+            public V8ScriptEngine Engine { get; private set; }
+
+            public bool IsExpired(TimeSpan maxAge)
+            {
+                return (maxAge != Timeout.InfiniteTimeSpan) && ((DateTime.UtcNow - creationTime) > maxAge);
+            }
+
+            public bool TryReset()
+            {
+                return MiscHelpers.Try(Engine.Reset);
+            }
+
+            public void Dispose()
+            {
+                Engine.Dispose();
+                runtime.Dispose();
+            }
+        }
+
+        #endregion
+    }
+}
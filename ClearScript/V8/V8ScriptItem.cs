@@ -42,6 +42,7 @@ namespace Microsoft.ClearScript.V8
                 switch (target.GetArrayBufferOrViewKind())
                 {
                     case V8ArrayBufferOrViewKind.ArrayBuffer:
+                    case V8ArrayBufferOrViewKind.SharedArrayBuffer:
                         return new V8ArrayBuffer(engine, target);
                     case V8ArrayBufferOrViewKind.DataView:
                         return new V8DataView(engine, target);
@@ -70,6 +71,11 @@ namespace Microsoft.ClearScript.V8
             return obj;
         }
 
+        public bool IsSharedArrayBuffer
+        {
+            get { return target.GetArrayBufferOrViewKind() == V8ArrayBufferOrViewKind.SharedArrayBuffer; }
+        }
+
         private void VerifyNotDisposed()
         {
             if (disposedFlag.IsSet)
@@ -273,6 +279,52 @@ namespace Microsoft.ClearScript.V8
 
         #endregion
 
+        #region ScriptObject overrides
+
+        public override object[] GetProperties(params string[] names)
+        {
+            VerifyNotDisposed();
+            MiscHelpers.VerifyNonNullArgument(names, "names");
+
+            var results = engine.MarshalToHost(engine.ScriptInvoke(() => target.GetProperties(names)), false);
+            foreach (var result in results)
+            {
+                var resultScriptItem = result as V8ScriptItem;
+                if ((resultScriptItem != null) && (resultScriptItem.engine == engine))
+                {
+                    resultScriptItem.holder = this;
+                }
+            }
+
+            return results;
+        }
+
+        public override void SetProperties(string[] names, object[] values)
+        {
+            VerifyNotDisposed();
+            MiscHelpers.VerifyNonNullArgument(names, "names");
+            MiscHelpers.VerifyNonNullArgument(values, "values");
+
+            if (names.Length != values.Length)
+            {
+                throw new ArgumentException("The name and value arrays must have the same length", "values");
+            }
+
+            engine.ScriptInvoke(() => target.SetProperties(names, engine.MarshalToScript(values)));
+        }
+
+        #endregion
+
+        #region Object graph export
+
+        public object ExportGraph(int maxDepth, int maxSize)
+        {
+            VerifyNotDisposed();
+            return V8ObjectGraph.Decode(engine.ScriptInvoke(() => target.ExportGraph(maxDepth, maxSize)));
+        }
+
+        #endregion
+
         #region IScriptMarshalWrapper implementation
 
         public override ScriptEngine Engine
@@ -385,6 +437,13 @@ namespace Microsoft.ClearScript.V8
                 });
             }
 
+            protected void InvokeWithDirectAccess(Action<IntPtr> action)
+            {
+                MiscHelpers.VerifyNonNullArgument(action, "action");
+                VerifyNotDisposed();
+                engine.ScriptInvoke(() => target.InvokeWithArrayBufferOrViewData(action));
+            }
+
             private V8ArrayBufferOrViewInfo GetInfo()
             {
                 VerifyNotDisposed();
@@ -453,6 +512,11 @@ namespace Microsoft.ClearScript.V8
                 return WriteBytes(source, sourceIndex, count, offset);
             }
 
+            void IArrayBuffer.InvokeWithDirectAccess(Action<IntPtr> action)
+            {
+                InvokeWithDirectAccess(action);
+            }
+
             #endregion
         }
 
@@ -499,6 +563,11 @@ namespace Microsoft.ClearScript.V8
                 return WriteBytes(source, sourceIndex, count, offset);
             }
 
+            void IArrayBufferView.InvokeWithDirectAccess(Action<IntPtr> action)
+            {
+                InvokeWithDirectAccess(action);
+            }
+
             #endregion
         }
 
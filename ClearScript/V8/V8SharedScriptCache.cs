@@ -0,0 +1,89 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+
+namespace Microsoft.ClearScript.V8
+{
+    /// <summary>
+    /// Controls the process-wide shared script cache.
+    /// </summary>
+    /// <remarks>
+    /// <para>
+    /// When the shared script cache is enabled, a script compiled via
+    /// <see cref="V8ScriptEngine.Compile(string)"/> or <see cref="V8Runtime.Compile(string)"/>
+    /// is registered in a process-wide cache along with code cache data produced by V8. Other V8
+    /// runtimes that compile the same code reuse the cache data instead of parsing and compiling
+    /// it again.
+    /// </para>
+    /// <para>
+    /// A compiled script produced while the cache is enabled can also be executed by any V8
+    /// runtime in the process. Each runtime instantiates the script from the cache data the first
+    /// time it executes it. Because the document name is part of the instantiated script,
+    /// compiling the same code under a different document name produces a separate instance.
+    /// </para>
+    /// <para>
+    /// While the cache is enabled, it takes the place of the per-runtime code cache directory
+    /// (see <see cref="V8Runtime.CodeCacheDirectory"/>), which is neither consulted nor updated.
+    /// </para>
+    /// <para>
+    /// The cache is disabled by default. It is bounded by <see cref="MaxSize"/> and evicts the
+    /// least recently used entries when that limit is exceeded. Compiled scripts whose cache
+    /// entries have been evicted remain valid.
+    /// </para>
+    /// </remarks>
+    public static class V8SharedScriptCache
+    {
+        /// <summary>
+        /// Gets or sets the maximum size of the shared script cache.
+        /// </summary>
+        /// <remarks>
+        /// The size of a cache entry is the combined size, in bytes, of its source code and code
+        /// cache data. Setting this property to zero disables the cache and evicts all entries.
+        /// </remarks>
+        public static UIntPtr MaxSize
+        {
+            get
+            {
+                using (var proxy = V8SharedScriptCacheProxy.Create())
+                {
+                    return proxy.MaxSize;
+                }
+            }
+
+            set
+            {
+                using (var proxy = V8SharedScriptCacheProxy.Create())
+                {
+                    proxy.MaxSize = value;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Gets usage information for the shared script cache.
+        /// </summary>
+        /// <returns>A <see cref="V8SharedScriptCacheInfo"/> object containing shared script cache usage information.</returns>
+        public static V8SharedScriptCacheInfo GetInfo()
+        {
+            using (var proxy = V8SharedScriptCacheProxy.Create())
+            {
+                return proxy.GetInfo();
+            }
+        }
+
+        /// <summary>
+        /// Removes all entries from the shared script cache and resets its usage counters.
+        /// </summary>
+        /// <remarks>
+        /// Compiled scripts that refer to removed entries remain valid.
+        /// </remarks>
+        public static void Clear()
+        {
+            using (var proxy = V8SharedScriptCacheProxy.Create())
+            {
+                proxy.Clear();
+            }
+        }
+    }
+}
@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+namespace Microsoft.ClearScript.V8
+{
+    /// <summary>
+    /// Contains usage information for the process-wide shared script cache.
+    /// </summary>
+    /// <seealso cref="V8SharedScriptCache.GetInfo"/>
+    public class V8SharedScriptCacheInfo
+    {
+        internal V8SharedScriptCacheInfo()
+        {
+        }
+
+        /// <summary>
+        /// Gets the number of scripts currently held in the cache.
+        /// </summary>
+        public ulong EntryCount { get; internal set; }
+
+        /// <summary>
+        /// Gets the total size, in bytes, of the source code and code cache data held in the cache.
+        /// </summary>
+        public ulong Size { get; internal set; }
+
+        /// <summary>
+        /// Gets the maximum size, in bytes, of the cache.
+        /// </summary>
+        public ulong MaxSize { get; internal set; }
+
+        /// <summary>
+        /// Gets the number of compilations for which a cache entry was found.
+        /// </summary>
+        public ulong HitCount { get; internal set; }
+
+        /// <summary>
+        /// Gets the number of compilations for which no cache entry was found.
+        /// </summary>
+        public ulong MissCount { get; internal set; }
+
+        /// <summary>
+        /// Gets the number of cache entries evicted to stay within the maximum size.
+        /// </summary>
+        public ulong EvictionCount { get; internal set; }
+
+        /// <summary>
+        /// Gets the number of times a shared script was instantiated in a V8 runtime from its code
+        /// cache data.
+        /// </summary>
+        public ulong InstantiationCount { get; internal set; }
+    }
+}
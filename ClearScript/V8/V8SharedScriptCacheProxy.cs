@@ -0,0 +1,21 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+
+namespace Microsoft.ClearScript.V8
+{
+    internal abstract class V8SharedScriptCacheProxy : V8Proxy
+    {
+        public static V8SharedScriptCacheProxy Create()
+        {
+            return CreateImpl<V8SharedScriptCacheProxy>();
+        }
+
+        public abstract UIntPtr MaxSize { get; set; }
+
+        public abstract V8SharedScriptCacheInfo GetInfo();
+
+        public abstract void Clear();
+    }
+}
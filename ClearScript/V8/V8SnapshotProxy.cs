@@ -0,0 +1,20 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+namespace Microsoft.ClearScript.V8
+{
+    internal abstract class V8SnapshotProxy : V8Proxy
+    {
+        public static V8SnapshotProxy Create(string name, string warmUpCode)
+        {
+            return CreateImpl<V8SnapshotProxy>(name, warmUpCode);
+        }
+
+        public static V8SnapshotProxy Create(byte[] bytes)
+        {
+            return CreateImpl<V8SnapshotProxy>(new object[] { bytes });
+        }
+
+        public abstract byte[] GetBytes();
+    }
+}
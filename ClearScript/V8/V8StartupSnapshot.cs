@@ -0,0 +1,131 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+using Microsoft.ClearScript.Util;
+
+namespace Microsoft.ClearScript.V8
+{
+    /// <summary>
+    /// Represents a serialized V8 heap with which V8 runtimes can be initialized.
+    /// </summary>
+    /// <remarks>
+    /// A startup snapshot captures the global state produced by a warm-up script, such as a
+    /// library or framework prelude. V8 runtimes created with a startup snapshot deserialize that
+    /// state instead of re-executing the warm-up script, significantly reducing the cost of
+    /// creating script engines that share a large common prelude. A startup snapshot is
+    /// immutable and can be shared by any number of V8 runtimes. It is bound to the exact V8
+    /// build that created it and cannot be used with a different version of ClearScript.
+    /// </remarks>
+    public sealed class V8StartupSnapshot : IDisposable
+    {
+        #region data
+
+        private readonly V8SnapshotProxy proxy;
+        private readonly InterlockedOneWayFlag disposedFlag = new InterlockedOneWayFlag();
+
+        #endregion
+
+        #region constructors
+
+        private V8StartupSnapshot(V8SnapshotProxy proxy)
+        {
+            this.proxy = proxy;
+        }
+
+        #endregion
+
+        #region public members
+
+        /// <summary>
+        /// Creates a startup snapshot by executing the specified warm-up script.
+        /// </summary>
+        /// <param name="warmUpCode">The script code to execute before the V8 heap is serialized.</param>
+        /// <returns>A new startup snapshot.</returns>
+        /// <remarks>
+        /// The warm-up script runs in a bare V8 context with no access to host objects or types.
+        /// </remarks>
+        public static V8StartupSnapshot Create(string warmUpCode)
+        {
+            return Create(null, warmUpCode);
+        }
+
+        /// <summary>
+        /// Creates a startup snapshot with the specified document name by executing the specified warm-up script.
+        /// </summary>
+        /// <param name="name">A document name for the warm-up script. Currently this name is used only as a label in presentation contexts such as error messages.</param>
+        /// <param name="warmUpCode">The script code to execute before the V8 heap is serialized.</param>
+        /// <returns>A new startup snapshot.</returns>
+        /// <remarks>
+        /// The warm-up script runs in a bare V8 context with no access to host objects or types.
+        /// </remarks>
+        public static V8StartupSnapshot Create(string name, string warmUpCode)
+        {
+            MiscHelpers.VerifyNonNullArgument(warmUpCode, "warmUpCode");
+            return new V8StartupSnapshot(V8SnapshotProxy.Create(string.IsNullOrEmpty(name) ? "V8StartupSnapshot" : name, warmUpCode));
+        }
+
+        /// <summary>
+        /// Loads a startup snapshot from the specified byte array.
+        /// </summary>
+        /// <param name="bytes">Startup snapshot data previously obtained via <see cref="ToBytes"/>.</param>
+        /// <returns>A new startup snapshot.</returns>
+        public static V8StartupSnapshot FromBytes(byte[] bytes)
+        {
+            MiscHelpers.VerifyNonNullArgument(bytes, "bytes");
+            return new V8StartupSnapshot(V8SnapshotProxy.Create(bytes));
+        }
+
+        /// <summary>
+        /// Returns the startup snapshot data as a byte array.
+        /// </summary>
+        /// <returns>A byte array suitable for persistent storage.</returns>
+        public byte[] ToBytes()
+        {
+            VerifyNotDisposed();
+            return proxy.GetBytes();
+        }
+
+        #endregion
+
+        #region internal members
+
+        internal V8SnapshotProxy Proxy
+        {
+            get
+            {
+                VerifyNotDisposed();
+                return proxy;
+            }
+        }
+
+        private void VerifyNotDisposed()
+        {
+            if (disposedFlag.IsSet)
+            {
+                throw new ObjectDisposedException(ToString());
+            }
+        }
+
+        #endregion
+
+        #region IDisposable implementation
+
+        /// <summary>
+        /// Releases all resources used by the startup snapshot.
+        /// </summary>
+        /// <remarks>
+        /// V8 runtimes created with the startup snapshot retain its data independently and are
+        /// unaffected by this method.
+        /// </remarks>
+        public void Dispose()
+        {
+            if (disposedFlag.Set())
+            {
+                proxy.Dispose();
+            }
+        }
+
+        #endregion
+    }
+}
@@ -8,6 +8,22 @@ namespace Microsoft.ClearScript.V8
         public ulong IsolateCount { get; set; }
 
         public ulong ContextCount { get; set; }
+
+        public ulong HostTypeTemplateCount { get; set; }
+
+        public ulong HostPropertyFetchCount { get; set; }
+
+        public ulong WorkerThreadCount { get; set; }
+
+        public ulong WorkerQueueDepth { get; set; }
+
+        public ulong WorkerTaskCount { get; set; }
+
+        public ulong WorkerStealCount { get; set; }
+
+        public ulong IdleTaskPostedCount { get; set; }
+
+        public ulong IdleTaskRunCount { get; set; }
     }
 
     internal abstract class V8TestProxy : V8Proxy
@@ -25,7 +25,11 @@ namespace Microsoft.ClearScript.Test
                 Console.WriteLine("1. SunSpider - JScript");
                 Console.WriteLine("2. SunSpider - V8 (default)");
                 Console.WriteLine("3. SunSpider - V8 (no GlobalMembers support)");
-                Console.WriteLine("4. Exit");
+                Console.WriteLine("4. String marshaling - V8");
+                Console.WriteLine("5. JSON exchange - V8");
+                Console.WriteLine("6. Parallel runner - V8");
+                Console.WriteLine("7. Call overhead - V8 (thread affinity)");
+                Console.WriteLine("8. Exit");
                 Console.WriteLine();
 
                 var exit = false;
@@ -62,6 +66,28 @@ namespace Microsoft.ClearScript.Test
                             break;
 
                         case 4:
+                            Run(() => new V8ScriptEngine(), Marshaling.RunSuite);
+                            done = true;
+                            break;
+
+                        case 5:
+                            Run(() => new V8ScriptEngine(), JsonExchange.RunSuite);
+                            done = true;
+                            break;
+
+                        case 6:
+                            Console.WriteLine();
+                            ParallelRunner.RunSuite();
+                            done = true;
+                            break;
+
+                        case 7:
+                            Console.WriteLine();
+                            ThreadAffinity.RunSuite();
+                            done = true;
+                            break;
+
+                        case 8:
                             done = true;
                             exit = true;
                             break;
@@ -0,0 +1,114 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.Linq;
+using System.Text;
+using Microsoft.ClearScript.V8;
+
+namespace Microsoft.ClearScript.Test
+{
+    internal static class JsonExchange
+    {
+        private const int recordCount = 1000;
+        private const int fieldCount = 10;
+        private const int iterationCount = 20;
+
+        public static void RunSuite(ScriptEngine engine)
+        {
+            var v8Engine = (V8ScriptEngine)engine;
+            v8Engine.Execute("function createObject() { return {}; }");
+            v8Engine.Execute("function createArray() { return []; }");
+
+            var records = CreateRecords();
+            var json = Encoding.UTF8.GetBytes(ToJson(records));
+            Console.WriteLine("Document: {0} records, {1} fields each, {2:#,0} bytes\n", recordCount, fieldCount, json.Length);
+
+            RunTest("Import - per-property marshaling", () => ImportPerProperty(v8Engine, records));
+            RunTest("Import - native JSON", () => v8Engine.ParseJson(json));
+
+            var root = v8Engine.ParseJson(json);
+            RunTest("Export - per-property marshaling", () => ExportPerProperty(root));
+            RunTest("Export - native JSON", () => v8Engine.StringifyJson(root));
+        }
+
+        private static void RunTest(string name, Action action)
+        {
+            action();
+
+            var stopwatch = Stopwatch.StartNew();
+            for (var index = 0; index < iterationCount; index++)
+            {
+                action();
+            }
+
+            stopwatch.Stop();
+
+            var milliseconds = stopwatch.Elapsed.TotalMilliseconds / iterationCount;
+            Console.WriteLine("{0,-36}{1,10:0.00} ms per document", name, milliseconds);
+        }
+
+        private static List<Dictionary<string, object>> CreateRecords()
+        {
+            var records = new List<Dictionary<string, object>>(recordCount);
+            for (var recordIndex = 0; recordIndex < recordCount; recordIndex++)
+            {
+                var record = new Dictionary<string, object>(fieldCount);
+                for (var fieldIndex = 0; fieldIndex < fieldCount; fieldIndex++)
+                {
+                    var name = "field" + fieldIndex.ToString(CultureInfo.InvariantCulture);
+                    if ((fieldIndex % 2) == 0)
+                    {
+                        record[name] = recordIndex * fieldIndex;
+                    }
+                    else
+                    {
+                        record[name] = "value " + recordIndex.ToString(CultureInfo.InvariantCulture);
+                    }
+                }
+
+                records.Add(record);
+            }
+
+            return records;
+        }
+
+        private static string ToJson(IEnumerable<Dictionary<string, object>> records)
+        {
+            return "[" + string.Join(",", records.Select(record => "{" + string.Join(",", record.Select(pair => "\"" + pair.Key + "\":" + ((pair.Value is string) ? "\"" + pair.Value + "\"" : Convert.ToString(pair.Value, CultureInfo.InvariantCulture)))) + "}")) + "]";
+        }
+
+        private static void ImportPerProperty(V8ScriptEngine engine, IEnumerable<Dictionary<string, object>> records)
+        {
+            var array = engine.Script.createArray();
+            var index = 0;
+
+            foreach (var record in records)
+            {
+                var obj = engine.Script.createObject();
+                foreach (var pair in record)
+                {
+                    obj[pair.Key] = pair.Value;
+                }
+
+                array[index++] = obj;
+            }
+        }
+
+        private static void ExportPerProperty(dynamic root)
+        {
+            var length = (int)root.length;
+            for (var recordIndex = 0; recordIndex < length; recordIndex++)
+            {
+                var record = root[recordIndex];
+                for (var fieldIndex = 0; fieldIndex < fieldCount; fieldIndex++)
+                {
+                    var unused = record["field" + fieldIndex.ToString(CultureInfo.InvariantCulture)];
+                }
+            }
+        }
+    }
+}
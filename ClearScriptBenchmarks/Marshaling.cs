@@ -0,0 +1,57 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+using System.Diagnostics;
+
+namespace Microsoft.ClearScript.Test
+{
+    internal static class Marshaling
+    {
+        private const int iterationCount = 200000;
+
+        public static void RunSuite(ScriptEngine engine)
+        {
+            engine.AccessContext = typeof(Marshaling);
+            engine.AddHostObject("echo", new Echo());
+            engine.Execute(@"
+                function run(value, count) {
+                    for (var index = 0; index < count; index++) {
+                        echo.Invoke(value);
+                    }
+                }
+            ");
+
+            RunTest(engine, "Short string (8 characters)", new string('x', 8));
+            RunTest(engine, "Inline limit (22 characters)", new string('x', 22));
+            RunTest(engine, "Medium string (64 characters)", new string('x', 64));
+            RunTest(engine, "Long string (4096 characters)", new string('x', 4096));
+        }
+
+        private static void RunTest(ScriptEngine engine, string name, string value)
+        {
+            // each iteration marshals the string from script to host and back
+
+            engine.Script.run(value, iterationCount / 10);
+
+            var stopwatch = Stopwatch.StartNew();
+            engine.Script.run(value, iterationCount);
+            stopwatch.Stop();
+
+            var nanoseconds = stopwatch.Elapsed.TotalMilliseconds * 1000000 / iterationCount;
+            Console.WriteLine("{0,-32}{1,10:0} ns per round trip", name, nanoseconds);
+        }
+
+        // ReSharper disable UnusedMember.Local
+
+        private class Echo
+        {
+            public string Invoke(string value)
+            {
+                return value;
+            }
+        }
+
+        // ReSharper restore UnusedMember.Local
+    }
+}
@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+using System.Diagnostics;
+using System.Linq;
+using Microsoft.ClearScript.V8;
+
+namespace Microsoft.ClearScript.Test
+{
+    internal static class ParallelRunner
+    {
+        private const int recordCount = 1000000;
+        private const int batchSize = 1000;
+        private const int maxRuntimeCount = 64;
+
+        private const string code = @"
+            (function (record) {
+                var hash = 2166136261;
+                for (var index = 0; index < record.length; index++) {
+                    hash ^= record.charCodeAt(index);
+                    hash = Math.imul(hash, 16777619);
+                }
+                return hash >>> 0;
+            })
+        ";
+
+        public static void RunSuite()
+        {
+            var records = Enumerable.Range(0, recordCount).Select(index => (object)("record-" + index + "-" + new string('x', index % 64))).ToArray();
+            Console.WriteLine("Workload: {0:#,0} records, {1:#,0} per batch, {2} processors\n", recordCount, batchSize, Environment.ProcessorCount);
+
+            double baseline = 0;
+            for (var runtimeCount = 1; runtimeCount <= maxRuntimeCount; runtimeCount *= 2)
+            {
+                using (var group = new V8RuntimeGroup(runtimeCount, code))
+                {
+                    // warm up each runtime before timing
+                    group.Invoke(records.Take(runtimeCount * batchSize).ToArray(), batchSize);
+
+                    var stopwatch = Stopwatch.StartNew();
+                    group.Invoke(records, batchSize);
+                    stopwatch.Stop();
+
+                    var throughput = recordCount / stopwatch.Elapsed.TotalSeconds;
+                    if (runtimeCount == 1)
+                    {
+                        baseline = throughput;
+                    }
+
+                    ulong batchCount, processedCount, stealCount;
+                    group.GetStatistics(out batchCount, out processedCount, out stealCount);
+                    Console.WriteLine("{0,2} runtimes: {1,12:#,0} records/s ({2,5:0.00}x), {3:#,0} batches stolen", runtimeCount, throughput, throughput / baseline, stealCount);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+using System;
+using System.Diagnostics;
+using Microsoft.ClearScript.V8;
+
+namespace Microsoft.ClearScript.Test
+{
+    internal static class ThreadAffinity
+    {
+        private const int callCount = 1000000;
+
+        public static void RunSuite()
+        {
+            Console.WriteLine("Workload: {0:#,0} host-to-script calls\n", callCount);
+
+            var baseline = Run("Default (locked)", V8ScriptEngineFlags.None);
+            var affine = Run("Thread-affine (lock-free)", V8ScriptEngineFlags.EnableThreadAffinity);
+            Console.WriteLine("{0,-32}{1,10:0.00}x", "Speedup", baseline / affine);
+        }
+
+        private static double Run(string label, V8ScriptEngineFlags flags)
+        {
+            using (var engine = new V8ScriptEngine(flags))
+            {
+                engine.Execute("function add(a, b) { return a + b; }");
+                var script = engine.Script;
+
+                // warm up before timing
+                for (var index = 0; index < 1000; index++)
+                {
+                    script.add(index, 1);
+                }
+
+                var stopwatch = Stopwatch.StartNew();
+                for (var index = 0; index < callCount; index++)
+                {
+                    script.add(index, 1);
+                }
+                stopwatch.Stop();
+
+                var nanoseconds = stopwatch.Elapsed.TotalMilliseconds * 1000000 / callCount;
+                Console.WriteLine("{0,-32}{1,10:0} ns per call", label, nanoseconds);
+                return nanoseconds;
+            }
+        }
+    }
+}
@@ -2270,6 +2270,21 @@ namespace Microsoft.ClearScript.Test
             Assert.AreEqual("qux", engine.Evaluate("foo.baz"));
         }
 
+        [TestMethod, TestCategory("JScriptEngine")]
+        public void JScriptEngine_BatchedPropertyAccess()
+        {
+            var obj = (ScriptObject)engine.Evaluate("({ foo: 123, bar: 'baz' })");
+
+            var values = obj.GetProperties("foo", "bar");
+            Assert.AreEqual(2, values.Length);
+            Assert.AreEqual(123, values[0]);
+            Assert.AreEqual("baz", values[1]);
+
+            obj.SetProperties(new[] { "foo", "qux" }, new object[] { 456, "quux" });
+            Assert.AreEqual(456, ((dynamic)obj).foo);
+            Assert.AreEqual("quux", ((dynamic)obj).qux);
+        }
+
         // ReSharper restore InconsistentNaming
 
 		#endregion
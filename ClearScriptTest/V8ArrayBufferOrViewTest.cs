@@ -4,6 +4,8 @@
 using System;
 using System.Diagnostics.CodeAnalysis;
 using System.Linq;
+using System.Runtime.InteropServices;
+using System.Threading;
 using Microsoft.ClearScript.JavaScript;
 using Microsoft.ClearScript.Util;
 using Microsoft.ClearScript.V8;
@@ -1694,6 +1696,77 @@ namespace Microsoft.ClearScript.Test
             TestUtil.AssertException<ArgumentOutOfRangeException>(() => ((ITypedArray<double>)engine.Script.typedArray).Write(testValues, 16384, 512, 0));
         }
 
+        [TestMethod, TestCategory("V8ArrayBufferOrView")]
+        public void V8ArrayBufferOrView_ExternalArrayBuffer()
+        {
+            const int size = 1024 * 1024;
+            var pData = Marshal.AllocHGlobal(size);
+            var released = new ManualResetEventSlim(false);
+
+            try
+            {
+                Marshal.WriteByte(pData, 0, 123);
+                Marshal.WriteByte(pData, size - 1, 45);
+
+                var arrayBuffer = (IArrayBuffer)engine.CreateExternalArrayBuffer(pData, size, released.Set);
+                Assert.AreEqual((ulong)size, arrayBuffer.Size);
+
+                engine.Script.arrayBuffer = arrayBuffer;
+                Assert.AreEqual(123 + 45, engine.Evaluate("bytes = new Uint8Array(arrayBuffer); bytes[0] + bytes[bytes.length - 1]"));
+
+                engine.Execute("bytes[1] = 67");
+                Assert.AreEqual(67, Marshal.ReadByte(pData, 1));
+
+                var pDirect = IntPtr.Zero;
+                ((ITypedArray)engine.Script.bytes).InvokeWithDirectAccess(pBytes => pDirect = pBytes);
+                Assert.AreEqual(pData, pDirect);
+
+                ((IDisposable)arrayBuffer).Dispose();
+                engine.Dispose();
+                Assert.IsTrue(released.Wait(TimeSpan.FromSeconds(10)));
+            }
+            finally
+            {
+                if (released.IsSet)
+                {
+                    Marshal.FreeHGlobal(pData);
+                }
+            }
+        }
+
+        [TestMethod, TestCategory("V8ArrayBufferOrView")]
+        public void V8ArrayBufferOrView_SharedArrayBuffer()
+        {
+            engine.Execute("sharedArrayBuffer = new SharedArrayBuffer(16); array = new Int32Array(sharedArrayBuffer)");
+            var sharedArrayBuffer = (IArrayBuffer)engine.Script.sharedArrayBuffer;
+            Assert.AreEqual(16UL, sharedArrayBuffer.Size);
+
+            engine.Script.sameBuffer = sharedArrayBuffer;
+            Assert.IsTrue((bool)engine.Evaluate("sameBuffer === sharedArrayBuffer"));
+
+            using (var otherEngine = new V8ScriptEngine())
+            {
+                otherEngine.Script.sharedArrayBuffer = sharedArrayBuffer;
+                otherEngine.Execute("array = new Int32Array(sharedArrayBuffer); array[0] = 42");
+                Assert.AreEqual(42, engine.Evaluate("array[0]"));
+
+                // Atomics.wait in one runtime is woken by Atomics.notify in another; notify reports
+                // a woken waiter only once the other thread is actually waiting
+
+                object waitResult = null;
+                var thread = new Thread(() => waitResult = otherEngine.Evaluate("Atomics.store(array, 2, 1); Atomics.wait(array, 1, 0, 5000)"));
+                thread.Start();
+
+                engine.Execute("notify = Atomics.notify || Atomics.wake");
+                Assert.IsTrue(SpinWait.SpinUntil(() => (bool)engine.Evaluate("(Atomics.load(array, 2) == 1) && (notify(array, 1, 1) == 1)"), TimeSpan.FromSeconds(5)));
+
+                Assert.IsTrue(thread.Join(TimeSpan.FromSeconds(5)));
+                Assert.AreEqual("ok", waitResult);
+            }
+
+            Assert.AreEqual(42, engine.Evaluate("array[0]"));
+        }
+
         // ReSharper restore InconsistentNaming
 
         #endregion
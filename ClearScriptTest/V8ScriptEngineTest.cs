@@ -11,6 +11,7 @@ using System.Globalization;
 using System.IO;
 using System.Linq;
 using System.Reflection;
+using System.Text;
 using System.Threading;
 using System.Windows.Threading;
 using Microsoft.CSharp.RuntimeBinder;
@@ -2923,6 +2924,757 @@ namespace Microsoft.ClearScript.Test
             Assert.AreEqual("qux", engine.Evaluate("foo.baz"));
         }
 
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_StartupSnapshot()
+        {
+            byte[] bytes;
+            using (var snapshot = V8StartupSnapshot.Create("function square(x) { return x * x; } var prelude = { answer: 42 };"))
+            {
+                bytes = snapshot.ToBytes();
+                Assert.IsTrue(bytes.Length > 0);
+
+                using (var runtime = new V8Runtime(null, null, V8RuntimeFlags.None, 0, snapshot))
+                {
+                    using (var testEngine = runtime.CreateScriptEngine())
+                    {
+                        Assert.AreEqual(49, testEngine.Evaluate("square(7)"));
+                        Assert.AreEqual(42, testEngine.Evaluate("prelude.answer"));
+
+                        testEngine.Script.foo = new[] { 1, 2, 3 };
+                        Assert.AreEqual(9, testEngine.Evaluate("square(foo[2])"));
+                    }
+                }
+            }
+
+            using (var snapshot = V8StartupSnapshot.FromBytes(bytes))
+            {
+                using (var runtime = new V8Runtime(null, null, V8RuntimeFlags.None, 0, snapshot))
+                {
+                    using (var testEngine = runtime.CreateScriptEngine())
+                    {
+                        Assert.AreEqual(144, testEngine.Evaluate("square(prelude.answer - 30)"));
+                    }
+                }
+            }
+
+            TestUtil.AssertException<ScriptEngineException>(() => V8StartupSnapshot.Create("throw new Error('bogus')"));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_EnginePool()
+        {
+            using (var pool = new V8ScriptEnginePool(1))
+            {
+                Assert.AreEqual(1, pool.IdleCount);
+                pool.MinIdleCount = 0;
+
+                var testEngine = pool.Rent();
+                Assert.AreEqual(0, pool.IdleCount);
+                Assert.AreEqual(1, pool.ActiveCount);
+
+                testEngine.AddHostObject("host", new HostFunctions());
+                testEngine.Script.foo = new[] { 1, 2, 3 };
+                testEngine.Execute("var bar = 123; baz = 456; function qux() { return foo; }");
+                Assert.AreEqual(3, testEngine.Evaluate("qux().Length"));
+
+                pool.Return(testEngine);
+                Assert.AreEqual(1, pool.IdleCount);
+                Assert.AreEqual(0, pool.ActiveCount);
+                Assert.AreEqual(1, pool.PeakActiveCount);
+
+                var recycledEngine = pool.Rent();
+                Assert.AreSame(testEngine, recycledEngine);
+                Assert.AreEqual("undefined", recycledEngine.Evaluate("typeof host"));
+                Assert.AreEqual("undefined", recycledEngine.Evaluate("typeof foo"));
+                Assert.AreEqual("undefined", recycledEngine.Evaluate("typeof bar"));
+                Assert.AreEqual("undefined", recycledEngine.Evaluate("typeof baz"));
+                Assert.AreEqual("undefined", recycledEngine.Evaluate("typeof qux"));
+                Assert.AreEqual(Math.PI, recycledEngine.Evaluate("Math.PI"));
+
+                TestUtil.AssertException<ArgumentException>(() => pool.Return(engine));
+                pool.Return(recycledEngine);
+
+                pool.MaxAge = TimeSpan.FromMilliseconds(1);
+                Thread.Sleep(10);
+
+                var freshEngine = pool.Rent();
+                Assert.AreNotSame(recycledEngine, freshEngine);
+                pool.Return(freshEngine);
+            }
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_CodeCacheDirectory()
+        {
+            var directoryPath = Path.Combine(Path.GetTempPath(), "ClearScriptTest-" + Guid.NewGuid().ToString("N"));
+            const string code = "(function () { var sum = 0; for (var i = 0; i < 10; i++) { sum += i; } return sum; })()";
+
+            try
+            {
+                using (var runtime = new V8Runtime())
+                {
+                    runtime.CodeCacheDirectory = directoryPath;
+                    Assert.AreEqual(directoryPath, runtime.CodeCacheDirectory);
+
+                    using (var testEngine = runtime.CreateScriptEngine())
+                    {
+                        using (var script = testEngine.Compile(code))
+                        {
+                            Assert.AreEqual(45, testEngine.Evaluate(script));
+                        }
+                    }
+
+                    var info = runtime.GetCodeCacheInfo();
+                    Assert.AreEqual(0UL, info.HitCount);
+                    Assert.AreEqual(1UL, info.MissCount);
+                    Assert.AreEqual(1UL, info.StoredCount);
+                }
+
+                using (var runtime = new V8Runtime())
+                {
+                    runtime.CodeCacheDirectory = directoryPath;
+
+                    using (var testEngine = runtime.CreateScriptEngine())
+                    {
+                        using (var script = testEngine.Compile(code))
+                        {
+                            Assert.AreEqual(45, testEngine.Evaluate(script));
+                        }
+                    }
+
+                    var info = runtime.GetCodeCacheInfo();
+                    Assert.AreEqual(1UL, info.HitCount);
+                    Assert.AreEqual(0UL, info.MissCount);
+                    Assert.AreEqual(1UL, info.AcceptedCount);
+                    Assert.AreEqual(0UL, info.RejectedCount);
+
+                    runtime.CodeCacheDirectory = null;
+                    Assert.AreEqual(0UL, runtime.GetCodeCacheInfo().HitCount);
+                }
+
+                // an entry whose code hash doesn't match is rejected even though its key matches
+
+                var filePath = Directory.GetFiles(directoryPath, "*.v8cache").Single();
+                var bytes = File.ReadAllBytes(filePath);
+                bytes[24] ^= 0xFF;
+                File.WriteAllBytes(filePath, bytes);
+
+                using (var runtime = new V8Runtime())
+                {
+                    runtime.CodeCacheDirectory = directoryPath;
+
+                    using (var testEngine = runtime.CreateScriptEngine())
+                    {
+                        using (var script = testEngine.Compile(code))
+                        {
+                            Assert.AreEqual(45, testEngine.Evaluate(script));
+                        }
+                    }
+
+                    var info = runtime.GetCodeCacheInfo();
+                    Assert.AreEqual(0UL, info.HitCount);
+                    Assert.AreEqual(1UL, info.MissCount);
+                }
+            }
+            finally
+            {
+                if (Directory.Exists(directoryPath))
+                {
+                    Directory.Delete(directoryPath, true);
+                }
+            }
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_CompileAsync()
+        {
+            var task = engine.CompileAsync("(function () { var sum = 0; for (var i = 0; i < 10; i++) { sum += i; } return sum; })()");
+            using (var script = task.Result)
+            {
+                Assert.AreEqual(45, engine.Evaluate(script));
+            }
+
+            using (var runtime = new V8Runtime())
+            {
+                using (var script = runtime.CompileAsync("Math.PI * 2").Result)
+                {
+                    using (var testEngine = runtime.CreateScriptEngine())
+                    {
+                        Assert.AreEqual(Math.PI * 2, testEngine.Evaluate(script));
+                    }
+                }
+            }
+
+            TestUtil.AssertException<ScriptEngineException>(() => engine.CompileAsync("function foo( {").Wait(), false);
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_CompileAsync_CodeCacheDirectory()
+        {
+            var directoryPath = Path.Combine(Path.GetTempPath(), "ClearScriptTest-" + Guid.NewGuid().ToString("N"));
+            const string code = "(function () { var sum = 0; for (var i = 0; i < 10; i++) { sum += i; } return sum; })()";
+
+            try
+            {
+                using (var runtime = new V8Runtime())
+                {
+                    runtime.CodeCacheDirectory = directoryPath;
+
+                    // no cache entry yet; the script is streamed and then cached
+                    using (var script = runtime.CompileAsync(code).Result)
+                    {
+                        using (var testEngine = runtime.CreateScriptEngine())
+                        {
+                            Assert.AreEqual(45, testEngine.Evaluate(script));
+                        }
+                    }
+
+                    var info = runtime.GetCodeCacheInfo();
+                    Assert.AreEqual(1UL, info.MissCount);
+                    Assert.AreEqual(1UL, info.StoredCount);
+
+                    // the cache entry is consumed synchronously
+                    using (var script = runtime.CompileAsync(code).Result)
+                    {
+                        using (var testEngine = runtime.CreateScriptEngine())
+                        {
+                            Assert.AreEqual(45, testEngine.Evaluate(script));
+                        }
+                    }
+
+                    info = runtime.GetCodeCacheInfo();
+                    Assert.AreEqual(1UL, info.HitCount);
+                    Assert.AreEqual(1UL, info.AcceptedCount);
+                }
+            }
+            finally
+            {
+                if (Directory.Exists(directoryPath))
+                {
+                    Directory.Delete(directoryPath, true);
+                }
+            }
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_LargeStringMarshaling()
+        {
+            var oneByteValue = new string('\u00E9', 100 * 1024);
+            engine.Script.oneByteValue = oneByteValue;
+            Assert.AreEqual(oneByteValue.Length, engine.Evaluate("oneByteValue.length"));
+            Assert.AreEqual(oneByteValue + "x", engine.Evaluate("oneByteValue + 'x'"));
+
+            var twoByteValue = new string('\u263A', 100 * 1024);
+            engine.Script.twoByteValue = twoByteValue;
+            Assert.AreEqual(twoByteValue.Length, engine.Evaluate("twoByteValue.length"));
+            Assert.AreEqual(twoByteValue + "x", engine.Evaluate("twoByteValue + 'x'"));
+
+            engine.Execute("shortValue = 'abc\u263A'");
+            Assert.AreEqual("abc\u263A", engine.Script.shortValue);
+            Assert.AreEqual(string.Empty, engine.Evaluate("''"));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_BatchedPropertyAccess()
+        {
+            var obj = (ScriptObject)engine.Evaluate("({ foo: 123, bar: 'baz', qux: { quux: true } })");
+
+            var values = obj.GetProperties("foo", "bar", "qux", "missing");
+            Assert.AreEqual(4, values.Length);
+            Assert.AreEqual(123, values[0]);
+            Assert.AreEqual("baz", values[1]);
+            Assert.IsTrue(((dynamic)values[2]).quux);
+            Assert.IsInstanceOfType(values[3], typeof(Undefined));
+
+            obj.SetProperties(new[] { "foo", "corge" }, new object[] { 456, "grault" });
+            Assert.AreEqual(456, ((dynamic)obj).foo);
+            Assert.AreEqual("grault", ((dynamic)obj).corge);
+
+            TestUtil.AssertException<ArgumentException>(() => obj.SetProperties(new[] { "foo" }, new object[0]));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_ExportGraph()
+        {
+            var root = (ScriptObject)engine.Evaluate("({ foo: 123, bar: [1.5, 'baz', null, undefined, true], qux: { quux: 'corge' } })");
+            var graph = (IDictionary<string, object>)engine.ExportGraph(root);
+
+            Assert.AreEqual(3, graph.Count);
+            Assert.AreEqual(123, graph["foo"]);
+
+            var bar = (object[])graph["bar"];
+            Assert.AreEqual(5, bar.Length);
+            Assert.AreEqual(1.5, bar[0]);
+            Assert.AreEqual("baz", bar[1]);
+            Assert.IsNull(bar[2]);
+            Assert.IsInstanceOfType(bar[3], typeof(Undefined));
+            Assert.AreEqual(true, bar[4]);
+
+            Assert.AreEqual("corge", ((IDictionary<string, object>)graph["qux"])["quux"]);
+
+            var cyclic = (ScriptObject)engine.Evaluate("(function () { var obj = { items: [] }; obj.items.push(obj); return obj; })()");
+            TestUtil.AssertException<ScriptEngineException>(() => engine.ExportGraph(cyclic), false);
+
+            var shared = (ScriptObject)engine.Evaluate("(function () { var item = { value: 1 }; return [item, item]; })()");
+            Assert.AreEqual(2, ((object[])engine.ExportGraph(shared)).Length);
+
+            var deep = (ScriptObject)engine.Evaluate("({ a: { b: { c: {} } } })");
+            TestUtil.AssertException<ScriptEngineException>(() => engine.ExportGraph(deep, 3, 1024), false);
+            Assert.IsInstanceOfType(engine.ExportGraph(deep, 4, 1024), typeof(IDictionary<string, object>));
+
+            var large = (ScriptObject)engine.Evaluate("['" + new string('x', 1024) + "']");
+            TestUtil.AssertException<ScriptEngineException>(() => engine.ExportGraph(large, 8, 1024), false);
+
+            var function = (ScriptObject)engine.Evaluate("({ method: function () {} })");
+            TestUtil.AssertException<ScriptEngineException>(() => engine.ExportGraph(function), false);
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_Json()
+        {
+            dynamic result = engine.ParseJson(Encoding.UTF8.GetBytes("{\"foo\":123,\"bar\":[\"baz\",\"\u263A\"],\"qux\":null}"));
+            Assert.AreEqual(123, result.foo);
+            Assert.AreEqual("baz", result.bar[0]);
+            Assert.AreEqual("\u263A", result.bar[1]);
+            Assert.IsNull(result.qux);
+
+            result.foo = 456;
+            Assert.AreEqual("{\"foo\":456,\"bar\":[\"baz\",\"\u263A\"],\"qux\":null}", Encoding.UTF8.GetString(engine.StringifyJson(result)));
+            Assert.AreEqual("\"abc\"", Encoding.UTF8.GetString(engine.StringifyJson("abc")));
+
+            TestUtil.AssertException<ScriptEngineException>(() => engine.ParseJson(Encoding.UTF8.GetBytes("{ foo: 123 }")), false);
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_HostObjectTemplate()
+        {
+            var testProxy = V8TestProxy.Create();
+            var templateCount = testProxy.GetCounters().HostTypeTemplateCount;
+
+            engine.AddHostObject("test", this);
+            engine.AddHostObject("other", new V8ScriptEngineTest());
+            engine.AccessContext = GetType();
+            engine.Execute("function run(obj) { for (var index = 0; index < 1000; index++) obj.PrivateMethod(); }");
+            engine.Script.run(engine.Script.test);
+            engine.Script.run(engine.Script.other);
+            Assert.IsTrue(testProxy.GetCounters().HostTypeTemplateCount > templateCount);
+
+            // once cached, members are read without fetching them from the host
+            var fetchCount = testProxy.GetCounters().HostPropertyFetchCount;
+            engine.Script.run(engine.Script.test);
+            engine.Script.run(engine.Script.other);
+            Assert.AreEqual(fetchCount, testProxy.GetCounters().HostPropertyFetchCount);
+
+            engine.AccessContext = null;
+            TestUtil.AssertException<ScriptEngineException>(() => engine.Execute("test.PrivateMethod()"));
+            TestUtil.AssertException<ScriptEngineException>(() => engine.Execute("other.PrivateMethod()"));
+
+            engine.AccessContext = GetType();
+            engine.Execute("test.PrivateMethod()");
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_HostObjectTemplate_Assignment()
+        {
+            engine.AddHostObject("test", this);
+            engine.AccessContext = GetType();
+            engine.Execute("test.PrivateMethod()");
+
+            // assignments to cached members still reach the host
+            TestUtil.AssertException<MissingMemberException>(() => engine.Execute("test.PrivateMethod = 123"));
+            TestUtil.AssertException<MissingMemberException>(() => engine.Execute("'use strict'; test.PrivateMethod = 123"));
+            Assert.AreEqual("function", engine.Evaluate("typeof test.PrivateMethod"));
+            engine.Execute("test.PrivateMethod()");
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_WorkerPool()
+        {
+            engine.Execute("var list = []; for (var index = 0; index < 1000000; index++) { list.push({ index: index }); if (list.length > 1000) list = []; }");
+            engine.CollectGarbage(true);
+
+            var counters = V8TestProxy.Create().GetCounters();
+            Assert.IsTrue(counters.WorkerThreadCount > 0UL);
+            Assert.IsTrue(counters.WorkerTaskCount > 0UL);
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_CallWithLockLatencyHistogram()
+        {
+            using (var runtime = new V8Runtime())
+            {
+                using (var testEngine = runtime.CreateScriptEngine())
+                {
+                    // promise settlement from another thread goes through the call-with-lock queue
+                    V8PromiseResolver resolver;
+                    testEngine.Script.promise = testEngine.CreatePromise(out resolver);
+
+                    var thread = new Thread(() =>
+                    {
+                        Thread.Sleep(250);
+                        resolver.Resolve(123);
+                    });
+
+                    thread.Start();
+                    testEngine.Execute("var start = Date.now(); while ((Date.now() - start) < 1500) {}");
+                    thread.Join();
+                }
+
+                var histogram = runtime.IsolateProxy.GetCallWithLockLatencyHistogram();
+                Assert.AreEqual(24, histogram.Length);
+                Assert.IsTrue(histogram.Aggregate(0UL, (sum, count) => sum + count) > 0UL);
+            }
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_NotifyIdle()
+        {
+            // allocation pressure prompts V8 to post idle tasks (e.g., to schedule a scavenge)
+
+            var testProxy = V8TestProxy.Create();
+            var postedCount = testProxy.GetCounters().IdleTaskPostedCount;
+            for (var attempt = 0; (attempt < 100) && (testProxy.GetCounters().IdleTaskPostedCount == postedCount); attempt++)
+            {
+                engine.Execute("var items = []; for (var i = 0; i < 100000; i++) { items.push({ index: i }); } items = null;");
+            }
+
+            var counters = testProxy.GetCounters();
+            Assert.IsTrue(counters.IdleTaskPostedCount > postedCount, "V8 posted no idle tasks");
+
+            var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+            engine.NotifyIdle(TimeSpan.FromMilliseconds(500));
+            Assert.IsTrue(stopwatch.Elapsed < TimeSpan.FromSeconds(5));
+
+            Assert.IsTrue(testProxy.GetCounters().IdleTaskRunCount > counters.IdleTaskRunCount, "No idle task ran");
+            Assert.AreEqual(123, engine.Evaluate("123"));
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_ThreadAffinity()
+        {
+            using (var runtime = new V8Runtime(V8RuntimeFlags.EnableThreadAffinity))
+            {
+                using (var testEngine = runtime.CreateScriptEngine())
+                {
+                    testEngine.AddHostObject("host", new HostFunctions());
+                    testEngine.Script.sum = 0;
+                    testEngine.Execute("for (var i = 0; i < 1000; i++) { sum += host.toInt32(i); }");
+                    Assert.AreEqual(499500, testEngine.Script.sum);
+
+                    Exception exception = null;
+                    var thread = new Thread(() =>
+                    {
+                        try
+                        {
+                            testEngine.Evaluate("sum");
+                        }
+                        catch (Exception threadException)
+                        {
+                            exception = threadException;
+                        }
+                    });
+
+                    thread.Start();
+                    thread.Join();
+
+                    Assert.IsInstanceOfType(exception, typeof(ScriptEngineException));
+                    Assert.AreEqual(499500, testEngine.Evaluate("sum"));
+                }
+            }
+
+            using (var testEngine = new V8ScriptEngine(V8ScriptEngineFlags.EnableThreadAffinity))
+            {
+                Assert.AreEqual(Math.PI, testEngine.Evaluate("Math.PI"));
+                using (var script = testEngine.Compile("Math.PI"))
+                {
+                    Assert.AreEqual(Math.PI, testEngine.Evaluate(script));
+                }
+            }
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_ThreadAffinity_Dispose()
+        {
+            using (var testEngine = new V8ScriptEngine(V8ScriptEngineFlags.EnableThreadAffinity))
+            {
+                Exception exception = null;
+                var thread = new Thread(() =>
+                {
+                    try
+                    {
+                        testEngine.Dispose();
+                    }
+                    catch (Exception threadException)
+                    {
+                        exception = threadException;
+                    }
+                });
+
+                thread.Start();
+                thread.Join();
+
+                Assert.IsInstanceOfType(exception, typeof(InvalidOperationException));
+                Assert.AreEqual(Math.PI, testEngine.Evaluate("Math.PI"));
+            }
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_TimeSlicing()
+        {
+            using (var runtime = new V8Runtime())
+            {
+                runtime.TimeSliceInterval = TimeSpan.FromMilliseconds(20);
+                Assert.AreEqual(TimeSpan.FromMilliseconds(20), runtime.TimeSliceInterval);
+
+                using (var engine1 = runtime.CreateScriptEngine())
+                {
+                    using (var engine2 = runtime.CreateScriptEngine())
+                    {
+                        Assert.AreEqual(TimeSpan.FromMilliseconds(20), engine1.RuntimeTimeSliceInterval);
+
+                        // each thread makes many short calls; with time slicing, neither can
+                        // keep the runtime until it's done, so their calls must interleave
+
+                        const string code = "(function () { var start = Date.now(); while (Date.now() - start < 2) {} })()";
+                        var log = new List<int>();
+                        var barrier = new Barrier(2);
+
+                        Func<V8ScriptEngine, int, Thread> createThread = (engine, id) => new Thread(() =>
+                        {
+                            barrier.SignalAndWait();
+                            for (var index = 0; index < 100; index++)
+                            {
+                                engine.Execute(code);
+                                lock (log)
+                                {
+                                    log.Add(id);
+                                }
+                            }
+                        });
+
+                        var thread1 = createThread(engine1, 1);
+                        var thread2 = createThread(engine2, 2);
+                        thread1.Start();
+                        thread2.Start();
+                        thread1.Join();
+                        thread2.Join();
+
+                        Assert.AreEqual(200, log.Count);
+                        var switchCount = log.Zip(log.Skip(1), (id1, id2) => id1 != id2).Count(switched => switched);
+                        Assert.IsTrue(switchCount > 2, "Calls did not interleave ({0} switches)", switchCount);
+
+                        // a single long-running call must also yield, so two such calls overlap
+
+                        const string longCode = "(function () { var start = Date.now(); while (Date.now() - start < 500) {} return [start, Date.now()]; })()";
+                        var task1 = engine1.EvaluateAsync(longCode);
+                        var task2 = engine2.EvaluateAsync(longCode);
+                        dynamic interval1 = task1.Result;
+                        dynamic interval2 = task2.Result;
+                        Assert.IsTrue((interval1[0] < interval2[1]) && (interval2[0] < interval1[1]), "Long-running calls did not overlap");
+                    }
+                }
+            }
+
+            using (var testEngine = new V8ScriptEngine())
+            {
+                testEngine.ExecuteAsync("foo = Math.PI").Wait();
+                Assert.AreEqual(Math.PI, testEngine.EvaluateAsync("foo").Result);
+            }
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_ExplicitMicrotasks()
+        {
+            using (var testEngine = new V8ScriptEngine(V8ScriptEngineFlags.EnableExplicitMicrotasks))
+            {
+                testEngine.Execute("var count = 0; Promise.resolve().then(function () { ++count; });");
+                Assert.AreEqual(0, testEngine.Evaluate("count"));
+
+                testEngine.DrainMicrotasks(TimeSpan.FromSeconds(1));
+                Assert.AreEqual(1, testEngine.Evaluate("count"));
+
+                V8PromiseResolver resolver;
+                testEngine.Script.promise = testEngine.CreatePromise(out resolver);
+                testEngine.Execute("var result; promise.then(function (value) { result = value; });");
+
+                var thread = new Thread(() => resolver.Resolve(123));
+                thread.Start();
+                thread.Join();
+
+                testEngine.DrainMicrotasks(TimeSpan.FromSeconds(1));
+                Assert.AreEqual(123, testEngine.Evaluate("result"));
+
+                testEngine.Script.promise = testEngine.CreatePromise(out resolver);
+                testEngine.Execute("var reason; promise.catch(function (value) { reason = value; });");
+                resolver.Reject("foo");
+                resolver.Resolve("bar");
+
+                testEngine.DrainMicrotasks(TimeSpan.FromSeconds(1));
+                Assert.AreEqual("foo", testEngine.Evaluate("reason"));
+            }
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_RuntimeGroup()
+        {
+            using (var group = new V8RuntimeGroup(4, "(function (x) { return x * 2; })"))
+            {
+                Assert.AreEqual(4, group.RuntimeCount);
+
+                var records = Enumerable.Range(0, 1000).Cast<object>().ToArray();
+                var results = group.Invoke(records, 16);
+                Assert.IsTrue(results.Select(Convert.ToInt32).SequenceEqual(Enumerable.Range(0, 1000).Select(index => index * 2)));
+
+                ulong batchCount, recordCount, stealCount;
+                group.GetStatistics(out batchCount, out recordCount, out stealCount);
+                Assert.AreEqual(63UL, batchCount);
+                Assert.AreEqual(1000UL, recordCount);
+
+                TestUtil.AssertException<ArgumentException>(() => group.Invoke(new[] { 1, 2, 3, new object() }, 1));
+            }
+
+            using (var group = new V8RuntimeGroup(2, "(function (x) { if (x === 5) throw new Error('foo'); return { value: x }; })"))
+            {
+                var results = group.Invoke(new object[] { 1, 2, 3 }, 1);
+                Assert.IsTrue(results.All(result => result is Undefined));
+                TestUtil.AssertException<ScriptEngineException>(() => group.Invoke(Enumerable.Range(0, 10).Cast<object>().ToArray(), 2));
+            }
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_SharedScriptCache()
+        {
+            const string code = "(function () { var sum = 0; for (var i = 0; i < 100; i++) sum += i; return sum; })()";
+
+            V8SharedScriptCache.MaxSize = (UIntPtr)(1024 * 1024);
+            V8SharedScriptCache.Clear();
+
+            try
+            {
+                using (var otherEngine = new V8ScriptEngine())
+                {
+                    using (var script = engine.Compile(code))
+                    {
+                        Assert.AreEqual(4950, engine.Evaluate(script));
+                        Assert.AreEqual(4950, otherEngine.Evaluate(script));
+                        Assert.AreEqual(4950, otherEngine.Evaluate(script));
+                    }
+
+                    using (var script = otherEngine.Compile(code))
+                    {
+                        Assert.AreEqual(4950, otherEngine.Evaluate(script));
+                    }
+
+                    var info = V8SharedScriptCache.GetInfo();
+                    Assert.AreEqual(1UL, info.EntryCount);
+                    Assert.AreEqual(1UL, info.HitCount);
+                    Assert.AreEqual(1UL, info.MissCount);
+                    Assert.AreEqual(2UL, info.InstantiationCount);
+
+                    V8SharedScriptCache.MaxSize = (UIntPtr)1;
+                    info = V8SharedScriptCache.GetInfo();
+                    Assert.AreEqual(0UL, info.EntryCount);
+                    Assert.AreEqual(1UL, info.EvictionCount);
+                }
+
+                // each document name gets its own instance, even within an isolate
+
+                V8SharedScriptCache.MaxSize = (UIntPtr)(1024 * 1024);
+                using (var script1 = engine.Compile("First", "new Error().stack"))
+                {
+                    using (var script2 = engine.Compile("Second", "new Error().stack"))
+                    {
+                        Assert.IsTrue(((string)engine.Evaluate(script1)).Contains("First"));
+                        Assert.IsTrue(((string)engine.Evaluate(script2)).Contains("Second"));
+                    }
+                }
+            }
+            finally
+            {
+                V8SharedScriptCache.MaxSize = UIntPtr.Zero;
+                V8SharedScriptCache.Clear();
+            }
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_CodeCacheAfterExecute()
+        {
+            const string code = "function square(x) { return x * x; } function cube(x) { return square(x) * x; } cube(3)";
+
+            byte[] lazyCacheBytes;
+            byte[] warmCacheBytes;
+            using (var tempEngine = new V8ScriptEngine())
+            {
+                using (var script = tempEngine.Compile(code, V8CacheKind.Code, out lazyCacheBytes))
+                {
+                    Assert.AreEqual(27, tempEngine.Evaluate(script));
+                    warmCacheBytes = tempEngine.CreateCacheBytes(script);
+                }
+            }
+
+            byte[] eagerCacheBytes;
+            using (var tempEngine = new V8ScriptEngine())
+            {
+                using (tempEngine.Compile(code, V8CacheKind.EagerCode, out eagerCacheBytes))
+                {
+                }
+            }
+
+            Assert.IsTrue(warmCacheBytes.Length > lazyCacheBytes.Length);
+            Assert.IsTrue(eagerCacheBytes.Length > lazyCacheBytes.Length);
+
+            bool cacheAccepted;
+            using (var script = engine.Compile(code, V8CacheKind.Code, warmCacheBytes, out cacheAccepted))
+            {
+                Assert.IsTrue(cacheAccepted);
+                Assert.AreEqual(27, engine.Evaluate(script));
+            }
+
+            using (var script = engine.Compile(code, V8CacheKind.EagerCode, eagerCacheBytes, out cacheAccepted))
+            {
+                Assert.IsTrue(cacheAccepted);
+                Assert.AreEqual(27, engine.Evaluate(script));
+            }
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_ArrayBufferHeapInfo()
+        {
+            var baseline = engine.GetRuntimeHeapInfo();
+
+            engine.Execute("small = []; for (var i = 0; i < 1000; i++) small.push(new Uint8Array(100)); large = new ArrayBuffer(1024 * 1024);");
+            Assert.AreEqual(0, engine.Evaluate("small.reduce(function (sum, array) { return sum + array.reduce(function (s, b) { return s + b; }, 0); }, 0)"));
+            Assert.AreEqual(0, engine.Evaluate("new Uint8Array(large).reduce(function (s, b) { return s + b; }, 0)"));
+
+            var heapInfo = engine.GetRuntimeHeapInfo();
+            Assert.IsTrue(heapInfo.ArrayBufferSize >= baseline.ArrayBufferSize + 1000 * 100 + 1024 * 1024);
+            Assert.IsTrue(heapInfo.ArrayBufferCount >= baseline.ArrayBufferCount + 1001);
+            Assert.IsTrue(heapInfo.PeakArrayBufferSize >= heapInfo.ArrayBufferSize);
+        }
+
+        [TestMethod, TestCategory("V8ScriptEngine")]
+        public void V8ScriptEngine_ExtendedHeapInfo()
+        {
+            var baseline = engine.GetRuntimeHeapInfo();
+            Assert.IsTrue(baseline.NativeContextCount > 0);
+            Assert.IsTrue(baseline.SpaceInfo.Count > 0);
+            Assert.IsTrue(baseline.SpaceInfo.Any(space => space.Name == "old_space"));
+            Assert.IsTrue(baseline.SpaceInfo.All(space => space.UsedSize <= space.Size));
+
+            Thread.Sleep(50);
+            engine.Execute("(function () { var items = []; for (var i = 0; i < 200000; i++) items.push({ index: i }); })()");
+            engine.CollectGarbage(true);
+
+            var snapshot = engine.GetRuntimeHeapInfoSnapshot();
+            Assert.IsTrue(snapshot.TotalAllocatedSize > baseline.TotalAllocatedSize + 200000UL * 16);
+            Assert.IsTrue(snapshot.AllocationRate > 0);
+            Assert.AreEqual(baseline.NativeContextCount, snapshot.NativeContextCount);
+            Assert.AreEqual(baseline.SpaceInfo.Count, snapshot.SpaceInfo.Count);
+
+            var heapInfo = engine.GetRuntimeHeapInfo();
+            Assert.IsTrue(heapInfo.TotalAllocatedSize >= snapshot.TotalAllocatedSize);
+        }
+
 		// ReSharper restore InconsistentNaming
 
 		#endregion